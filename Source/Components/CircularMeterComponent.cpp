@@ -38,16 +38,32 @@ void CircularMeterComponent::setValues(double lufs, double truePeakDB, double de
     currentContentType = contentType;
 
     // Calculate normalized level for arc (0-1 range)
-    targetLevel = static_cast<float>(
-        (lufs - DSPSSOT::TruePeak::MIN_DISPLAY_DB) / (-DSPSSOT::TruePeak::MIN_DISPLAY_DB)
-    );
-    targetLevel = juce::jlimit(0.0f, 1.0f, targetLevel);
+    targetLevel = lufsToLevel(lufs);
+}
+
+void CircularMeterComponent::setWindowedLoudness(double momentaryLUFS, double shortTermLUFS)
+{
+    // Sliding windows are already smoothed by the DSP core - no animation
+    momentaryLevel = lufsToLevel(momentaryLUFS);
+    shortTermLevel = lufsToLevel(shortTermLUFS);
 }
 
 // ========================================================================
 // PRIVATE METHODS
 // ========================================================================
 
+float CircularMeterComponent::lufsToLevel(double lufs)
+{
+    // EDGE CASE: NaN/infinity maps to an empty arc
+    if (std::isnan(lufs) || std::isinf(lufs))
+        return 0.0f;
+
+    float level = static_cast<float>(
+        (lufs - DSPSSOT::TruePeak::MIN_DISPLAY_DB) / (-DSPSSOT::TruePeak::MIN_DISPLAY_DB)
+    );
+    return juce::jlimit(0.0f, 1.0f, level);
+}
+
 juce::Colour CircularMeterComponent::getStatusColor() const
 {
     if (std::abs(currentDeviation) <= DSPSSOT::DeviationDisplay::BALANCED_RANGE_LU)
@@ -150,6 +166,42 @@ void CircularMeterComponent::paint(juce::Graphics& g)
         g.strokePath(arcPath, juce::PathStrokeType(12.0f, juce::PathStrokeType::curved));
     }
 
+    // Momentary loudness (thin inner arc) and short-term loudness (tick)
+    {
+        float startAngle = -135.0f * DSPSSOT::Math::PI / 180.0f;
+        float arcSpan = 270.0f * DSPSSOT::Math::PI / 180.0f;
+        float innerRadius = radius - 18.0f;
+
+        if (momentaryLevel > 0.0f)
+        {
+            juce::Path momentaryPath;
+            momentaryPath.addCentredArc(
+                centerX, centerY,
+                innerRadius, innerRadius,
+                0.0f,
+                startAngle,
+                startAngle + arcSpan * momentaryLevel,
+                true
+            );
+
+            g.setColour(UISSOT::Colors::textSecondary());
+            g.strokePath(momentaryPath, juce::PathStrokeType(3.0f, juce::PathStrokeType::curved));
+        }
+
+        if (shortTermLevel > 0.0f)
+        {
+            // Angle measured clockwise from 12 o'clock (JUCE arc convention)
+            float angle = startAngle + arcSpan * shortTermLevel;
+            float sinA = std::sin(angle);
+            float cosA = std::cos(angle);
+
+            g.setColour(UISSOT::Colors::textPrimary());
+            g.drawLine(centerX + (innerRadius - 4.0f) * sinA, centerY - (innerRadius - 4.0f) * cosA,
+                       centerX + (innerRadius + 4.0f) * sinA, centerY - (innerRadius + 4.0f) * cosA,
+                       2.0f);
+        }
+    }
+
     // Outline ring
     g.setColour(UISSOT::Colors::meterCenterLine());
     g.drawEllipse(circle, 1.0f);
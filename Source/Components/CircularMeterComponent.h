@@ -9,6 +9,7 @@
  * Circular Meter Component
  *
  * Displays LUFS-I as a filled arc (donut meter) with smooth animation.
+ * A thin inner arc follows momentary loudness; a tick marks short-term loudness.
  * Color indicates status: green (balanced), red (hot), blue (quiet).
  * More professional than LED strip, uses less vertical space.
  */
@@ -35,6 +36,7 @@ public:
     // ========================================================================
 
     void setValues(double lufs, double truePeakDB, double deviationLU, ModelSSOT::ContentType contentType);
+    void setWindowedLoudness(double momentaryLUFS, double shortTermLUFS);
 
 private:
     // ========================================================================
@@ -51,11 +53,16 @@ private:
     float animatedLevel{0.0f};
     float targetLevel{0.0f};
 
+    // Momentary / short-term levels (0-1, 0 = not yet measured)
+    float momentaryLevel{0.0f};
+    float shortTermLevel{0.0f};
+
     // ========================================================================
     // PRIVATE METHODS
     // ========================================================================
 
     void timerCallback() override;
+    static float lufsToLevel(double lufs);
     juce::Colour getStatusColor() const;
     juce::String getStatusText() const;
 
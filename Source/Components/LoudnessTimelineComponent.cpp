@@ -0,0 +1,146 @@
+#include "LoudnessTimelineComponent.h"
+
+// ========================================================================
+// CONSTRUCTOR / DESTRUCTOR
+// ========================================================================
+
+LoudnessTimelineComponent::LoudnessTimelineComponent(const LoudnessTimeline& t)
+    : timeline(t)
+{
+}
+
+// ========================================================================
+// STATE UPDATES
+// ========================================================================
+
+void LoudnessTimelineComponent::setTargetLUFS(double lufs)
+{
+    if (std::isnan(lufs) || std::isinf(lufs))
+        return;
+
+    if (lufs != targetLUFS)
+    {
+        targetLUFS = lufs;
+        repaint();
+    }
+}
+
+// ========================================================================
+// JUCE LIFECYCLE
+// ========================================================================
+
+void LoudnessTimelineComponent::paint(juce::Graphics& g)
+{
+    auto bounds = getLocalBounds().toFloat();
+
+    // Background
+    g.fillAll(UISSOT::Colors::background());
+
+    // Label row: title and visible span
+    auto labelRow = bounds.removeFromTop(16.0f);
+    g.setFont(UISSOT::Typography::labelFont());
+    g.setColour(UISSOT::Colors::textSecondary());
+    g.drawText(UISSOT::Strings::timelineLabel(), labelRow, juce::Justification::centredLeft);
+    g.drawText(spanText(viewSeconds), labelRow, juce::Justification::centredRight);
+
+    auto plot = bounds.reduced(0.0f, static_cast<float>(UISSOT::Dimensions::MARGIN_SMALL));
+    g.setColour(UISSOT::Colors::panel());
+    g.fillRect(plot);
+
+    // Grid lines every TIMELINE_GRID_STEP_LU
+    g.setFont(UISSOT::Typography::meterFont());
+    for (double lufs = UISSOT::Dimensions::TIMELINE_MAX_LUFS;
+         lufs > UISSOT::Dimensions::TIMELINE_MIN_LUFS;
+         lufs -= UISSOT::Dimensions::TIMELINE_GRID_STEP_LU)
+    {
+        const float y = lufsToY(lufs, plot);
+        g.setColour(UISSOT::Colors::timelineGrid());
+        g.drawHorizontalLine(static_cast<int>(y), plot.getX(), plot.getRight());
+        g.setColour(UISSOT::Colors::textMuted());
+        g.drawText(juce::String(static_cast<int>(lufs)), juce::Rectangle<float>(plot.getX() + 2.0f, y, 24.0f, 12.0f),
+                   juce::Justification::centredLeft);
+    }
+
+    // History: one column per pixel (O(width) regardless of session length)
+    const int numColumns = static_cast<int>(columns.size());
+    if (numColumns > 0)
+    {
+        const auto spanFrames = static_cast<std::int64_t>(
+            viewSeconds * 1000.0 / DSPSSOT::Timeline::FRAME_DURATION_MS);
+        timeline.render(spanFrames, columns.data(), numColumns);
+
+        const float columnWidth = plot.getWidth() / static_cast<float>(numColumns);
+        juce::Path meanPath;
+        bool penDown = false;
+
+        g.setColour(UISSOT::Colors::timelineRange());
+        for (int c = 0; c < numColumns; ++c)
+        {
+            const LoudnessTimeline::Column& column = columns[static_cast<size_t>(c)];
+            if (!column.valid)
+            {
+                penDown = false;
+                continue;
+            }
+
+            const float x = plot.getX() + columnWidth * static_cast<float>(c);
+            const float yTop = lufsToY(column.maxLUFS, plot);
+            const float yBottom = lufsToY(column.minLUFS, plot);
+            g.fillRect(x, yTop, columnWidth, std::max(yBottom - yTop, 1.0f));
+
+            const float yMean = lufsToY(column.meanLUFS, plot);
+            if (penDown)
+                meanPath.lineTo(x + columnWidth * 0.5f, yMean);
+            else
+                meanPath.startNewSubPath(x + columnWidth * 0.5f, yMean);
+            penDown = true;
+        }
+
+        g.setColour(UISSOT::Colors::timelineMean());
+        g.strokePath(meanPath, juce::PathStrokeType(1.5f));
+    }
+
+    // Content-type target
+    g.setColour(UISSOT::Colors::ledTargetMarker());
+    g.drawHorizontalLine(static_cast<int>(lufsToY(targetLUFS, plot)), plot.getX(), plot.getRight());
+}
+
+void LoudnessTimelineComponent::resized()
+{
+    // One render column per pixel; allocation happens only here, never in paint()
+    columns.assign(static_cast<size_t>(std::max(getWidth(), 0)), LoudnessTimeline::Column{});
+}
+
+void LoudnessTimelineComponent::mouseWheelMove(const juce::MouseEvent&, const juce::MouseWheelDetails& wheel)
+{
+    if (wheel.deltaY == 0.0f)
+        return;
+
+    // Wheel up zooms in (shorter span), wheel down zooms out
+    const double factor = (wheel.deltaY > 0.0f) ? 1.0 / UISSOT::Dimensions::TIMELINE_ZOOM_STEP
+                                                : UISSOT::Dimensions::TIMELINE_ZOOM_STEP;
+    viewSeconds = juce::jlimit(DSPSSOT::Timeline::MIN_VIEW_SECONDS,
+                               DSPSSOT::Timeline::MAX_VIEW_SECONDS,
+                               viewSeconds * factor);
+    repaint();
+}
+
+// ========================================================================
+// PRIVATE METHODS
+// ========================================================================
+
+float LoudnessTimelineComponent::lufsToY(double lufs, juce::Rectangle<float> plot) const
+{
+    const double range = UISSOT::Dimensions::TIMELINE_MAX_LUFS - UISSOT::Dimensions::TIMELINE_MIN_LUFS;
+    const double normalized = juce::jlimit(0.0, 1.0, (lufs - UISSOT::Dimensions::TIMELINE_MIN_LUFS) / range);
+    return plot.getBottom() - static_cast<float>(normalized) * plot.getHeight();
+}
+
+juce::String LoudnessTimelineComponent::spanText(double seconds)
+{
+    if (seconds < 120.0)
+        return juce::String(juce::roundToInt(seconds)) + " s";
+    if (seconds < 2.0 * 3600.0)
+        return juce::String(juce::roundToInt(seconds / 60.0)) + " min";
+    return juce::String(seconds / 3600.0, 1) + " h";
+}
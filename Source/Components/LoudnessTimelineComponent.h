@@ -0,0 +1,64 @@
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <vector>
+#include "../SSOT/UISSOT.h"
+#include "../SSOT/DSPSSOT.h"
+#include "../DSP/LoudnessTimeline.h"
+
+/**
+ * Loudness Timeline Component
+ *
+ * Scrolling loudness-over-time view: a band between momentary min and max
+ * and a line for the mean loudness of each pixel column, plus the
+ * content-type target. The newest frame is at the right edge.
+ * Mouse wheel zooms the visible span from 10 seconds to 3 hours.
+ *
+ * Reads a LoudnessTimeline (mipmapped history) owned by the processor;
+ * paint cost depends only on the component width, never on session length.
+ */
+class LoudnessTimelineComponent : public juce::Component
+{
+public:
+    // ========================================================================
+    // CONSTRUCTOR / DESTRUCTOR
+    // ========================================================================
+
+    explicit LoudnessTimelineComponent(const LoudnessTimeline& timeline);
+    ~LoudnessTimelineComponent() override = default;
+
+    // ========================================================================
+    // JUCE LIFECYCLE
+    // ========================================================================
+
+    void paint(juce::Graphics& g) override;
+    void resized() override;
+    void mouseWheelMove(const juce::MouseEvent& event, const juce::MouseWheelDetails& wheel) override;
+
+    // ========================================================================
+    // STATE UPDATES
+    // ========================================================================
+
+    void setTargetLUFS(double lufs);
+
+private:
+    // ========================================================================
+    // PRIVATE MEMBERS
+    // ========================================================================
+
+    const LoudnessTimeline& timeline;
+    double viewSeconds{DSPSSOT::Timeline::DEFAULT_VIEW_SECONDS};
+    double targetLUFS{DSPSSOT::LoudnessTargets::DEFAULT_TARGET};
+
+    // Render scratch, one entry per pixel column (resized only in resized())
+    std::vector<LoudnessTimeline::Column> columns;
+
+    // ========================================================================
+    // PRIVATE METHODS
+    // ========================================================================
+
+    float lufsToY(double lufs, juce::Rectangle<float> plot) const;
+    static juce::String spanText(double seconds);
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LoudnessTimelineComponent)
+};
@@ -1,5 +1,24 @@
 #include "StatusDisplayComponent.h"
 
+namespace
+{
+    // EDGE CASE: NaN/infinity shown as floor, values clamped to display range
+    double clampDisplayLUFS(double lufs)
+    {
+        if (std::isnan(lufs) || std::isinf(lufs))
+            return DSPSSOT::TruePeak::MIN_DISPLAY_DB;
+        return juce::jlimit(DSPSSOT::TruePeak::MIN_DISPLAY_DB, DSPSSOT::TruePeak::MAX_DISPLAY_DB, lufs);
+    }
+
+    // Windowed loudness text: "--.-" until the window has filled once
+    juce::String windowedLUFSText(double lufs)
+    {
+        if (lufs <= DSPSSOT::TruePeak::MIN_DISPLAY_DB)
+            return UISSOT::Strings::noMeasurement();
+        return juce::String(lufs, 1);
+    }
+}
+
 // ========================================================================
 // CONSTRUCTOR
 // ========================================================================
@@ -39,6 +58,26 @@ void StatusDisplayComponent::setValues(double lufs, double truePeakDB, double de
     repaint();
 }
 
+void StatusDisplayComponent::setWindowedLoudness(double momentaryLUFS, double shortTermLUFS,
+                                                 double maxMomentaryLUFS, double maxShortTermLUFS)
+{
+    currentMomentary = clampDisplayLUFS(momentaryLUFS);
+    currentShortTerm = clampDisplayLUFS(shortTermLUFS);
+    currentMaxMomentary = clampDisplayLUFS(maxMomentaryLUFS);
+    currentMaxShortTerm = clampDisplayLUFS(maxShortTermLUFS);
+    repaint();
+}
+
+void StatusDisplayComponent::setLoudnessRange(double loudnessRangeLU)
+{
+    // EDGE CASE: NaN/infinity or negative range shown as 0 LU
+    if (std::isnan(loudnessRangeLU) || std::isinf(loudnessRangeLU) || loudnessRangeLU < 0.0)
+        loudnessRangeLU = 0.0;
+
+    currentLoudnessRange = loudnessRangeLU;
+    repaint();
+}
+
 void StatusDisplayComponent::updateDeviationNormalized()
 {
     // Map deviation to 0-1 range (0 = left edge, 0.5 = center, 1 = right edge)
@@ -129,6 +168,13 @@ void StatusDisplayComponent::paint(juce::Graphics& g)
     }
     g.drawText("LUFS-I: " + lufsText, bounds, juce::Justification::centredTop);
 
+    // Loudness Range (EBU Tech 3342), top right
+    g.setFont(UISSOT::Typography::meterFont());
+    g.setColour(UISSOT::Colors::textSecondary());
+    juce::String lraText = UISSOT::Strings::loudnessRangeLabel() + " " +
+                           juce::String(currentLoudnessRange, 1) + " LU";
+    g.drawText(lraText, bounds, juce::Justification::topRight);
+
     // Draw deviation status text
     g.setFont(UISSOT::Typography::labelFont());
     g.setColour(statusColor);
@@ -195,7 +241,14 @@ void StatusDisplayComponent::paint(juce::Graphics& g)
     g.setColour(UISSOT::Colors::textSecondary());
     juce::String tpText = UISSOT::Strings::truePeakLabel() + ": " +
                           juce::String(currentTruePeak, 1) + " dBTP";
-    g.drawText(tpText, bounds, juce::Justification::centredBottom);
+    g.drawText(tpText, bounds, juce::Justification::bottomRight);
+
+    // Momentary / short-term loudness with maxima in brackets
+    juce::String windowText = UISSOT::Strings::momentaryLabel() + " " + windowedLUFSText(currentMomentary) +
+                              " (" + windowedLUFSText(currentMaxMomentary) + ")  " +
+                              UISSOT::Strings::shortTermLabel() + " " + windowedLUFSText(currentShortTerm) +
+                              " (" + windowedLUFSText(currentMaxShortTerm) + ")";
+    g.drawText(windowText, bounds, juce::Justification::bottomLeft);
 }
 
 void StatusDisplayComponent::resized()
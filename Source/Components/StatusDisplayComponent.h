@@ -8,7 +8,8 @@
 /**
  * Status Display Component
  *
- * Displays LUFS-I measurement, True Peak, and deviation bar.
+ * Displays LUFS-I measurement, True Peak, and deviation bar,
+ * plus momentary / short-term loudness, their maxima and Loudness Range.
  * Visualizes loudness status with color-coded feedback.
  */
 class StatusDisplayComponent : public juce::Component
@@ -33,6 +34,9 @@ public:
     // ========================================================================
 
     void setValues(double lufs, double truePeakDB, double deviationLU, ModelSSOT::ContentType contentType);
+    void setWindowedLoudness(double momentaryLUFS, double shortTermLUFS,
+                             double maxMomentaryLUFS, double maxShortTermLUFS);
+    void setLoudnessRange(double loudnessRangeLU);
 
 private:
     // ========================================================================
@@ -45,6 +49,13 @@ private:
     double currentDeviation{0.0};
     ModelSSOT::ContentType currentContentType{ModelSSOT::ContentType::MusicDrums};
 
+    // Momentary / short-term loudness (already computed by the DSP core)
+    double currentMomentary{DSPSSOT::TruePeak::MIN_DISPLAY_DB};
+    double currentShortTerm{DSPSSOT::TruePeak::MIN_DISPLAY_DB};
+    double currentMaxMomentary{DSPSSOT::TruePeak::MIN_DISPLAY_DB};
+    double currentMaxShortTerm{DSPSSOT::TruePeak::MIN_DISPLAY_DB};
+    double currentLoudnessRange{0.0};
+
     // Deviation bar calculation
     double deviationNormalized{0.5};  // 0.5 = center (balanced)
 
@@ -2,36 +2,65 @@
 
 #include <cmath>
 #include <atomic>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
 #include "../SSOT/ModelSSOT.h"
 #include "../SSOT/DSPSSOT.h"
 #include "../SSOT/ProcessorSSOT.h"
+#include "BULLsEYEProcessorFwd.h"
+#include "FeaturePolicy.h"
+#include "PrecisionPolicy.h"
+#include "KWeightingFilter.h"
+#include "HalfbandDecimator.h"
+#include "KWeightingBlockFilter.h"
+#include "LoudnessHistogram.h"
+#include "TruePeakDetector.h"
+#include "MeterFrame.h"
+#include "LoudnessHistory.h"
 
 /**
  * BULLsEYE DSP Core - TETRIS Compliant
  *
  * Processes audio for LUFS-I measurement and True Peak detection.
- * Implements ITU-R BS.1770 K-weighting and gated integration.
+ * Implements ITU-R BS.1770 K-weighting and gated integration, plus
+ * EBU R128 momentary (400 ms) and short-term (3 s) loudness, and
+ * EBU Tech 3342 Loudness Range (LRA).
  *
  * TETRIS Principles:
  * - T: Thread Separation (no UI access)
  * - E: Encapsulation (private state, validated setters)
  * - T: Trivially Copyable (static_assert)
  * - R: Reference Processing (template process())
- * - I: Internal Double (process in double)
+ * - I: Internal Double (process in double; see PrecisionPolicy for the
+ *      reduced-precision filter / accumulator variants)
  * - S: Smoothing (for parameter transitions)
+ *
+ * FeatureSet selects the meters that are computed (see FeaturePolicy);
+ * disabled stages, their state and their published atomics are compiled out.
+ * BULLsEYEProcessorCore is the double precision, all-meters instantiation.
  */
-class BULLsEYEProcessorCore
+template<typename PrecisionPolicy, typename FeatureSet>
+class BasicBULLsEYEProcessorCore
 {
 public:
+    using FilterType = typename PrecisionPolicy::Filter;
+    using AccumulatorType = typename PrecisionPolicy::Accumulator;
+    using FeatureSetType = FeatureSet;
+
     // ========================================================================
     // CONSTRUCTOR
     // ========================================================================
 
-    BULLsEYEProcessorCore() noexcept
+    BasicBULLsEYEProcessorCore() noexcept
     {
         // Initialize filter coefficients and states for the default sample rate
         recalculateFilterCoefficients();
         updateBlockSize();
+        updateDecimation();
+        updateTruePeakOversampling();
         resetFilters();
     }
 
@@ -44,12 +73,11 @@ public:
      */
     void setContentType(ModelSSOT::ContentType type) noexcept
     {
+        // Any thread: the audio thread picks the change up at its next publication
+        // (deviation is re-derived there, so a frame never mixes two content types)
         int typeInt = static_cast<int>(type);
-        if (typeInt != currentContentType.load())
-        {
-            currentContentType.store(typeInt);
-            targetLUFS = ModelSSOT::Helpers::getTargetLUFS(type);
-        }
+        if (typeInt != contentType.load(std::memory_order_relaxed))
+            contentType.store(typeInt, std::memory_order_relaxed);
     }
 
     /**
@@ -59,8 +87,8 @@ public:
     void setSampleRate(double newSampleRate) noexcept
     {
         // Validate sample rate is within realistic bounds
-        constexpr double MIN_VALID_SR = 8000.0;   // Minimum realistic sample rate
-        constexpr double MAX_VALID_SR = 1000000.0; // Maximum realistic sample rate (1 MHz)
+        constexpr double MIN_VALID_SR = ProcessorSSOT::SampleRate::MIN_VALID_SAMPLE_RATE;
+        constexpr double MAX_VALID_SR = ProcessorSSOT::SampleRate::MAX_VALID_SAMPLE_RATE;
 
         if (newSampleRate != sampleRate &&
             newSampleRate >= MIN_VALID_SR &&
@@ -72,10 +100,85 @@ public:
             recalculateFilterCoefficients();
 
             updateBlockSize();
+            updateDecimation();
+            updateTruePeakOversampling();
             resetFilters();
         }
     }
 
+    /**
+     * High-rate loudness path (off by default): at 176.4 kHz and above,
+     * K-weighting and gating run on a halfband-decimated copy of the input
+     * (44.1 / 48 kHz) while True Peak stays on the native-rate signal.
+     * Loudness of programme band-limited to 20 kHz stays within
+     * HighRate::ACCURACY_BOUND_LU of the native-rate measurement; content
+     * above 20 kHz is not measured.
+     * Resets the meters when the setting changes (call at prepare time)
+     */
+    void setHighRateDecimation(bool enabled) noexcept
+    {
+        if (enabled != highRateDecimation)
+        {
+            highRateDecimation = enabled;
+            updateDecimation();
+            reset();
+        }
+    }
+
+    /**
+     * Block-parallel K-weighting (off by default): each channel is filtered
+     * 8 samples per step by KWeightingBlockFilter instead of the lane-packed
+     * bank. Faster for mono streams, and for stereo on AVX builds; results
+     * differ from the bank only by rounding (well below 1e-9 LU). Per-sample
+     * and block processing stay
+     * consistent with each other.
+     * Resets the meters when the setting changes (call at prepare time)
+     */
+    void setBlockParallelKWeighting(bool enabled) noexcept
+    {
+        if (enabled != blockParallelKWeighting)
+        {
+            blockParallelKWeighting = enabled;
+            reset();
+        }
+    }
+
+    /**
+     * Set BS.1770 channel weights (G_i) for multichannel measurement
+     * e.g. 5.1: {1.0, 1.0, 1.0, 0.0, 1.41, 1.41} (L R C LFE Ls Rs)
+     * Validates count and values; invalid weights are treated as excluded (0.0)
+     */
+    void setChannelWeights(const double* weights, int numChannels) noexcept
+    {
+        if constexpr (FeatureSet::K_WEIGHTING)
+        {
+            if (weights == nullptr || numChannels <= 0)
+                return;
+
+            numChannels = std::min(numChannels, MAX_CHANNELS);
+
+            for (int ch = 0; ch < MAX_CHANNELS; ++ch)
+            {
+                double w = (ch < numChannels) ? weights[ch] : DSPSSOT::ChannelWeighting::FRONT;
+                if (std::isnan(w) || std::isinf(w) || w < 0.0)
+                    w = DSPSSOT::ChannelWeighting::LFE;
+                channelWeights[ch] = static_cast<AccumulatorType>(w);
+            }
+        }
+    }
+
+    /**
+     * Size the loudness history stream (one record per 100 ms hop)
+     * NOT real-time safe: allocates when the capacity changes. Call before
+     * processing starts (prepareToPlay), never concurrently with processing;
+     * a reader may keep draining. Queued records are discarded.
+     */
+    void setHistoryCapacity(int numRecords)
+    {
+        if constexpr (FeatureSet::STATS)
+            history.setCapacity(static_cast<std::size_t>(std::max(numRecords, 0)));
+    }
+
     // ========================================================================
     // RESET
     // ========================================================================
@@ -88,6 +191,71 @@ public:
         resetFilters();
         resetIntegration();
         resetTruePeak();
+        silentChannels = MAX_CHANNELS;  // every history is zero again
+    }
+
+    // ========================================================================
+    // SEGMENTED MEASUREMENT (offline)
+    // ========================================================================
+
+    /**
+     * Restart measurement but keep signal state (filters, True Peak history,
+     * sub-block ring): the audio processed so far only warms the core up.
+     * Used to measure a segment of a file: process a warm-up run ending at
+     * the segment start, call this, then process the segment. Call at a
+     * 100 ms sub-block boundary; a warm-up of one full short-term ring
+     * (3 s) leaves every window of the segment identical to a sequential pass.
+     */
+    void resetMeasurement() noexcept
+    {
+        hopSamplePeak = 0.0;
+        if constexpr (FeatureSet::INTEGRATED)
+            blockHistogram.reset();
+        if constexpr (FeatureSet::LOUDNESS_RANGE)
+            shortTermHistogram.reset();
+        if constexpr (FeatureSet::TRUE_PEAK)
+            truePeak.resetPeaks();
+        tpBufferedPeak = 0.0;
+        tpUpdateCounter = 0;
+        relativeGateEnergy = std::numeric_limits<double>::infinity();
+        meters = MeterLevels{};
+        meters.contentType = getContentType();
+        metersDirty = true;
+        publishFrame();
+    }
+
+    /**
+     * Append the measurement of the segment that follows this one
+     * Block and short-term histograms are summed and gated once over all
+     * blocks (exact two-pass gating), maxima and True Peak merge by max,
+     * and the current momentary / short-term values come from the later
+     * segment. NOT real-time safe: reads the other core unsynchronized,
+     * call only after both have finished processing.
+     */
+    void mergeMeasurement(const BasicBULLsEYEProcessorCore& later) noexcept
+    {
+        if constexpr (FeatureSet::INTEGRATED)
+            blockHistogram.merge(later.blockHistogram);
+        if constexpr (FeatureSet::LOUDNESS_RANGE)
+            shortTermHistogram.merge(later.shortTermHistogram);
+        if constexpr (FeatureSet::TRUE_PEAK)
+            truePeak.mergePeaks(later.truePeak);
+
+        meters.samplePosition += later.meters.samplePosition;
+        meters.totalSamplesProcessed += later.meters.totalSamplesProcessed;
+        meters.momentaryEnergy = later.meters.momentaryEnergy;
+        meters.shortTermEnergy = later.meters.shortTermEnergy;
+        meters.maxMomentaryEnergy = std::max(meters.maxMomentaryEnergy, later.meters.maxMomentaryEnergy);
+        meters.maxShortTermEnergy = std::max(meters.maxShortTermEnergy, later.meters.maxShortTermEnergy);
+
+        if constexpr (FeatureSet::INTEGRATED)
+            updateIntegrated();
+        if constexpr (FeatureSet::LOUDNESS_RANGE)
+            updateLoudnessRange();
+        if constexpr (FeatureSet::TRUE_PEAK)
+            tpBufferedPeak = truePeak.getPeak();
+        metersDirty = true;
+        publishFrame();
     }
 
     // ========================================================================
@@ -102,68 +270,214 @@ public:
     template<typename SampleType>
     void process(SampleType& left, SampleType& right) noexcept
     {
-        // Process internally in double (TETRIS Internal Double)
-        double lDouble = static_cast<double>(left);
-        double rDouble = static_cast<double>(right);
+        AccumulatorType energy = 0;
 
-        // EDGE CASE: Check for NaN or infinity in input samples
-        // Optimized: combined check with early exit
-        if (std::isnan(lDouble) || std::isinf(lDouble))
-            lDouble = 0.0;
-        if (std::isnan(rDouble) || std::isinf(rDouble))
-            rDouble = 0.0;
+        // Sanitize and filter in FilterType (double: TETRIS Internal Double)
+        // EDGE CASE: NaN/infinity and denormal inputs are flushed to zero
+        const FilterType l = sanitizeInput(static_cast<FilterType>(left));
+        const FilterType r = sanitizeInput(static_cast<FilterType>(right));
 
-        // EDGE CASE: Check for denormal values (combined with NaN check above)
-        if (std::abs(lDouble) < DSPSSOT::TruePeak::DENORM_THRESHOLD)
-            lDouble = 0.0;
-        if (std::abs(rDouble) < DSPSSOT::TruePeak::DENORM_THRESHOLD)
-            rDouble = 0.0;
+        // Silence on silent histories: filter output and True Peak are zero, skip both
+        hopChannels = std::max(hopChannels, 2);
+        const bool silent = silentChannels >= 2 && l == 0 && r == 0;
+        if (!silent)
+            silentChannels = 0;
 
-        // Apply K-weighting filters (optimized: uses cached coefficients)
-        lDouble = applyKWeightingLeft(lDouble);
-        rDouble = applyKWeightingRight(rDouble);
+        if constexpr (FeatureSet::K_WEIGHTING)
+        {
+            if (!silent)
+            {
+                if constexpr (FeatureSet::STATS)
+                    hopSamplePeak = std::max(hopSamplePeak, static_cast<double>(std::max(std::abs(l), std::abs(r))));
 
-        // EDGE CASE: Check for NaN/infinity after K-weighting
-        if (std::isnan(lDouble) || std::isinf(lDouble))
-            lDouble = 0.0;
-        if (std::isnan(rDouble) || std::isinf(rDouble))
-            rDouble = 0.0;
+                alignas(SIMD::VECTOR_ALIGNMENT) FilterType frame[STEREO_STRIDE]{};
+                frame[0] = l;
+                frame[1] = r;
 
-        // Calculate energy (sum of squares) - no overflow check needed in practice
-        double energy = lDouble * lDouble + rDouble * rDouble;
+                // High-rate mode: only frames the decimator emits are K-weighted
+                if (decimator.processFrames(frame, STEREO_STRIDE, 1) > 0)
+                {
+                    // Apply K-weighting filters to both channels in one SIMD vector
+                    kWeightFrames(frame, STEREO_STRIDE, 2, 1);
 
-        // Accumulate for gated integration
-        accumulateEnergy(energy);
+                    // Calculate weighted energy (sum of squares)
+                    // EDGE CASE: Check for NaN/infinity after K-weighting
+                    energy = frameEnergy(frame, 2);
+                }
+            }
+            else
+            {
+                decimator.skip(1);
+            }
+        }
 
-        // True Peak detection (4x oversampling with Hermite interpolation)
+        // True Peak detection (polyphase FIR, 4x/2x/1x by sample rate)
         // Uses ORIGINAL input samples (before K-weighting), matching JSFX reference
-        updateTruePeak(left, right);
+        // Runs before the hop check so the sample lands in this hop's history record
+        if constexpr (FeatureSet::TRUE_PEAK)
+            updateTruePeak(left, right, silent);
+
+        // Accumulate for gated integration
+        meters.samplePosition++;
+        accumulateEnergy(energy);
 
         // Passthrough: output ORIGINAL samples unmodified (meter plugin)
         // JSFX reference: spl0=spl0_out; spl1=spl1_out; (original input passed through)
     }
 
+    /**
+     * Process a block of stereo samples (read-only, meter plugin)
+     * Bit-identical to calling process() for every sample pair
+     */
+    template<typename SampleType>
+    void processBlock(const SampleType* left, const SampleType* right, int numSamples) noexcept
+    {
+        const SampleType* channels[2] = {left, right};
+        processBlock(channels, 2, numSamples);
+    }
+
+    /**
+     * Process a block of multichannel samples (read-only, meter plugin)
+     * Channels are weighted with setChannelWeights() and feed one gated integrator.
+     * Compared to per-sample processing:
+     * - sanitizes and K-weights the buffer in tight per-stage loops,
+     *   with channels packed into SIMD lanes
+     * - splits the loop at 100 ms sub-block boundaries, so the
+     *   block-complete check runs once per segment instead of per sample
+     * - publishes True Peak once per host block instead of every TP_BATCH_SIZE samples
+     * - skips filtering and True Peak for silent input once the filter and
+     *   True Peak histories have settled to zero (idle tracks cost a scan)
+     */
+    template<typename SampleType>
+    void processBlock(const SampleType* const* channels, int numChannels, int numSamples) noexcept
+    {
+        numChannels = std::min(numChannels, MAX_CHANNELS);
+        if (channels == nullptr || numChannels <= 0)
+            return;
+
+        int offset = 0;
+
+        while (offset < numSamples)
+        {
+            // Never let a segment cross a 100 ms sub-block boundary
+            int segmentLength = numSamples - offset;
+            if (subBlockSize > 0)
+                segmentLength = std::min(segmentLength, subBlockSize - subBlockCount);
+            hopChannels = std::max(hopChannels, numChannels);
+
+            // Silence on silent histories changes no meter: advance the
+            // counters up to the first non-zero sample
+            if (silentChannels >= numChannels)
+            {
+                const int silent = leadingSilence(channels, numChannels, offset, segmentLength);
+                if (silent > 0)
+                {
+                    if constexpr (FeatureSet::K_WEIGHTING)
+                        decimator.skip(silent);
+                    advanceSegment(silent);
+                    offset += silent;
+                    continue;
+                }
+                silentChannels = 0;
+            }
+
+            // ... nor the scratch size
+            segmentLength = std::min(segmentLength, ProcessorSSOT::Buffer::PROCESS_CHUNK_SIZE);
+            processSegment(channels, numChannels, offset, segmentLength);
+            offset += segmentLength;
+        }
+
+        // Publish one meter frame per host block (timestamp always advances)
+        metersDirty = true;
+        if constexpr (FeatureSet::TRUE_PEAK)
+            tpBufferedPeak = truePeak.getPeak();
+        publishFrame();
+    }
+
     // ========================================================================
     // GETTERS
     // ========================================================================
 
-    ModelSSOT::ContentType getContentType() const noexcept 
-    { 
-        return static_cast<ModelSSOT::ContentType>(currentContentType.load()); 
+    ModelSSOT::ContentType getContentType() const noexcept
+    {
+        return static_cast<ModelSSOT::ContentType>(contentType.load(std::memory_order_relaxed));
+    }
+    double getTargetLUFS() const noexcept { return ModelSSOT::Helpers::getTargetLUFS(getContentType()); }
+
+    /**
+     * Consistent snapshot of every meter value (wait-free for the audio thread)
+     * UI code should read this once per frame instead of the individual getters
+     */
+    MeterFrame getMeterFrame() const noexcept { return published.read(); }
+
+    // Individual readings (each one reads a consistent frame and converts only its value)
+    double getIntegratedLUFS() const noexcept { return DSPSSOT::Helpers::energyToDisplayLUFS(published.readLevels().integratedEnergy); }
+    double getTruePeakDB() const noexcept { return DSPSSOT::Helpers::truePeakToDisplayDB(published.readLevels().truePeak); }
+    double getDeviationLU() const noexcept { return published.read().deviationLU; }
+    double getMomentaryLUFS() const noexcept { return DSPSSOT::Helpers::energyToDisplayLUFS(published.readLevels().momentaryEnergy); }
+    double getShortTermLUFS() const noexcept { return DSPSSOT::Helpers::energyToDisplayLUFS(published.readLevels().shortTermEnergy); }
+    double getMaxMomentaryLUFS() const noexcept { return DSPSSOT::Helpers::energyToDisplayLUFS(published.readLevels().maxMomentaryEnergy); }
+    double getMaxShortTermLUFS() const noexcept { return DSPSSOT::Helpers::energyToDisplayLUFS(published.readLevels().maxShortTermEnergy); }
+    double getLoudnessRangeLU() const noexcept { return published.readLevels().loudnessRangeLU; }
+    /**
+     * True while silent input skips filtering and True Peak (histories settled to zero)
+     * Processing thread only (tests, offline tools); not synchronized
+     */
+    bool isIdle() const noexcept { return silentChannels > 0; }
+
+    // Decimation factor of the loudness path (1 unless high-rate mode is on at >= 176.4 kHz)
+    int getDecimationFactor() const noexcept { return decimationFactor; }
+
+    int getTruePeakOversamplingFactor() const noexcept
+    {
+        if constexpr (FeatureSet::TRUE_PEAK)
+            return truePeak.getOversamplingFactor();
+        else
+            return 1;
     }
-    double getTargetLUFS() const noexcept { return targetLUFS; }
-    double getIntegratedLUFS() const noexcept { return integratedLUFS.load(); }
-    double getTruePeakDB() const noexcept { return truePeakDB.load(); }
-    double getDeviationLU() const noexcept { return deviationLU.load(); }
-    int getSampleSum() const noexcept { return sampleSum.load(); }
-    int getTotalSamplesProcessed() const noexcept { return totalSamplesProcessed.load(); }
+
+    /**
+     * Input samples (summed over channels) the True Peak detector interpolated;
+     * the early out skipped the rest. Processing thread only (tests, benchmarks)
+     */
+    long long getTruePeakInterpolatedSamples() const noexcept
+    {
+        if constexpr (FeatureSet::TRUE_PEAK)
+            return truePeak.getInterpolatedSamples();
+        else
+            return 0;
+    }
+
+    /**
+     * Hand queued history records to fn(const LoudnessHopRecord&), oldest first
+     * Single reader (e.g. the message thread); returns the number of records
+     */
+    template<typename Fn>
+    std::size_t drainHistory(Fn&& fn)
+    {
+        if constexpr (FeatureSet::STATS)
+            return history.drain(std::forward<Fn>(fn));
+        else
+            return 0;
+    }
+
+    // History records lost because the stream was full (nobody drained it in time)
+    std::uint64_t getHistoryDroppedCount() const noexcept
+    {
+        if constexpr (FeatureSet::STATS)
+            return history.getDroppedCount();
+        else
+            return 0;
+    }
+    std::int64_t getSampleSum() const noexcept { return published.readLevels().sampleSum; }
+    std::int64_t getTotalSamplesProcessed() const noexcept { return published.readLevels().totalSamplesProcessed; }
 
     /**
      * Get normalized LUFS for UI display (0-1 range)
      */
     float getNormalizedLUFS() const noexcept
     {
-        double lufs = integratedLUFS.load();
+        double lufs = getIntegratedLUFS();
         if (lufs < DSPSSOT::TruePeak::MIN_DISPLAY_DB)
             return 0.0f;
         return static_cast<float>((lufs - DSPSSOT::TruePeak::MIN_DISPLAY_DB) /
@@ -175,9 +489,10 @@ public:
      */
     float getNormalizedTruePeak() const noexcept
     {
-        double tp = truePeakDB.load();
-        return static_cast<float>((tp - DSPSSOT::TruePeak::MIN_DISPLAY_DB) /
-                                   (-DSPSSOT::TruePeak::MIN_DISPLAY_DB));
+        double tp = getTruePeakDB();
+        // Inter-sample overs can read above 0 dBTP: clamp to full scale
+        double normalized = (tp - DSPSSOT::TruePeak::MIN_DISPLAY_DB) / (-DSPSSOT::TruePeak::MIN_DISPLAY_DB);
+        return static_cast<float>(std::min(std::max(normalized, 0.0), 1.0));
     }
 
 private:
@@ -185,60 +500,125 @@ private:
     // PRIVATE STATE (TETRIS - trivially copyable)
     // ========================================================================
 
-    // Content type and target
-    // Fixes RC-2: currentContentType is now atomic for thread-safe UI reads
-    std::atomic<int> currentContentType{static_cast<int>(ModelSSOT::ContentType::MusicDrums)};
-    double targetLUFS{DSPSSOT::LoudnessTargets::MUSIC_DRUMS};
-    double sampleRate{ProcessorSSOT::SampleRate::DEFAULT_SAMPLE_RATE};
-
-    // Integration state
-    int blockSize{0};
-    double blockAccumulator{0.0};
-    int blockCount{0};
-    double energySum{0.0};
-    // Fixes RC-1: sampleSum is now atomic for thread-safe cross-thread reads
-    std::atomic<int> sampleSum{0};
-    // Fixes Law 2.5: track all processed samples (not just gated) for reliable transport detection
-    std::atomic<int> totalSamplesProcessed{0};
-
-    // True Peak atomic batching (reduce atomic access frequency)
+    // Layout (hot / cold split):
+    // - hot: per-sample audio-thread scalars, first cache lines of the object
+    // - warm: per-hop state (sub-block ring, audio-side meter values)
+    // - cold: configuration, histograms, filter bank, True Peak, history stream, scratch
+    // - published: UI-read atomics on their own cache lines at the end,
+    //   written with relaxed stores at most once per host block
+    // State of stages outside FeatureSet is an empty Features::Disabled member
+    static constexpr std::size_t CACHE_LINE = ProcessorSSOT::Performance::CACHE_LINE_PADDING;
+
+    template<bool Enabled, typename T>
+    using Optional = ::Features::Optional<Enabled, T>;
+
+    // ---- Hot: touched every sample ----
+    alignas(CACHE_LINE) AccumulatorType subBlockAccumulator{0};
+    int subBlockCount{0};
+    int subBlockSize{0};
+    int decimationFactor{1};           // loudness path runs at sampleRate / decimationFactor
     int tpUpdateCounter{0};
-    double tpBufferedDB{DSPSSOT::TruePeak::MIN_DISPLAY_DB};
-    static constexpr int TP_BATCH_SIZE = 100; // Update atomic every N samples
-
-    // True Peak state (4-sample buffer for Hermite interpolation)
-    double tpLeftBuffer[4]{0, 0, 0, 0};
-    double tpRightBuffer[4]{0, 0, 0, 0};
-    double tpPeakLeft{0.0};
-    double tpPeakRight{0.0};
-    double tpPeakMax{0.0};
-
-    // Atomics for thread-safe UI access
-    std::atomic<double> integratedLUFS{DSPSSOT::TruePeak::MIN_DISPLAY_DB};
-    std::atomic<double> truePeakDB{DSPSSOT::TruePeak::MIN_DISPLAY_DB};
-    std::atomic<double> deviationLU{0.0};
-
-    // K-weighting filter states and CACHED coefficients
-    // HP states: [0]=x[n-1], [1]=x[n-2], [2]=y[n-1], [3]=y[n-2]
-    double hpStateL[4]{0, 0, 0, 0};
-    double hpStateR[4]{0, 0, 0, 0};
-    // HS states: [0]=x[n-1] (HP output), [1]=x[n-2], [2]=y[n-1], [3]=y[n-2]
-    double hsStateL[4]{0, 0, 0, 0};
-    double hsStateR[4]{0, 0, 0, 0};
-    // Fixes DI-3: shared coefficients (L and R use identical filter parameters)
-    double hpCoeffs[5]{0, 0, 0, 0, 0};
-    double hsCoeffs[5]{0, 0, 0, 0, 0};
+    double tpBufferedPeak{0.0};        // linear; readers convert to dBTP
+    double hopSamplePeak{0.0};         // largest |x| in the current 100 ms hop
+    int silentChannels{MAX_CHANNELS};  // leading channels with all-zero filter / TP histories (silence fast path)
+    int hopChannels{0};                // channels processed in the current hop
+    static constexpr int TP_BATCH_SIZE = 100; // Update atomic every N samples (per-sample path)
+
+    // Channel configuration
+    static constexpr int MAX_CHANNELS = ProcessorSSOT::Channels::MAX_INPUT_CHANNELS;
+    using FilterBank = KWeightingBank<MAX_CHANNELS, FilterType>;
+    static constexpr int STEREO_STRIDE = SIMD::roundUpToLanes(2, FilterBank::LANES);
+    Optional<FeatureSet::K_WEIGHTING, AccumulatorType[MAX_CHANNELS]> channelWeights{1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1};
+
+    // ---- Warm: touched once per 100 ms hop ----
+    // Integration state (100 ms sub-blocks, 400 ms gating blocks with 75% overlap)
+    // Ring of the last 30 sub-block energy sums (3 s short-term window)
+    // Running sums give the 400 ms and 3 s windows in O(1) per hop
+    static constexpr int MOMENTARY_SUB_BLOCKS = DSPSSOT::LoudnessWindows::MOMENTARY_SUB_BLOCKS;
+    static constexpr int SUB_BLOCK_RING_SIZE = DSPSSOT::LoudnessWindows::SHORT_TERM_SUB_BLOCKS;
+    alignas(CACHE_LINE) Optional<FeatureSet::K_WEIGHTING, AccumulatorType[SUB_BLOCK_RING_SIZE]> subBlockEnergy{};
+    int energySubBlockSize{0};         // K-weighted frames per sub-block (subBlockSize / decimationFactor)
+    int subBlockRingIndex{0};
+    int subBlocksFilled{0};
+    AccumulatorType momentarySum{0};
+    AccumulatorType shortTermSum{0};
+
+    // Audio-side meter values: the audio thread reads and updates these and
+    // never reloads a published atomic (linear / energy, see MeterLevels)
+    MeterLevels meters;
+    bool metersDirty{false};           // meters changed since last publication
+    // Relative gate as an energy, refreshed when integrated loudness changes
+    double relativeGateEnergy{std::numeric_limits<double>::infinity()};
+
+    // ---- Cold: configuration and large per-hop / per-channel state ----
+    // Content type control value (written by any thread, rarely changes)
+    std::atomic<int> contentType{static_cast<int>(ModelSSOT::ContentType::MusicDrums)};
+    double sampleRate{ProcessorSSOT::SampleRate::DEFAULT_SAMPLE_RATE};
+    bool highRateDecimation{false};
+    bool blockParallelKWeighting{false};
+
+    // Constant-memory store of all gating blocks (exact two-pass relative gate)
+    Optional<FeatureSet::INTEGRATED, LoudnessHistogram> blockHistogram;
+    // Constant-memory store of short-term values (one per hop) for LRA percentiles
+    Optional<FeatureSet::LOUDNESS_RANGE, LoudnessHistogram> shortTermHistogram;
+
+    // True Peak state (per channel polyphase FIR history and running peaks)
+    Optional<FeatureSet::TRUE_PEAK, TruePeakDetector<MAX_CHANNELS>> truePeak;
+
+    // Per-hop records for history readers (preallocated, wait-free push)
+    Optional<FeatureSet::STATS, LoudnessHistoryRing> history;
+
+    // K-weighting filter bank (channels packed into SIMD lanes) and CACHED coefficients
+    Optional<FeatureSet::K_WEIGHTING, FilterBank> kWeighting;
+    // High-rate mode: halfband cascade in front of the filter bank (same lane layout)
+    Optional<FeatureSet::K_WEIGHTING, HalfbandDecimator<MAX_CHANNELS, FilterType>> decimator;
+    // Block-parallel mode: per-channel state-space filter used instead of the bank
+    Optional<FeatureSet::K_WEIGHTING, KWeightingBlockFilter<MAX_CHANNELS, FilterType>> blockFilter;
+    // Fixes DI-3: shared coefficients (all channels use identical filter parameters)
+    Optional<FeatureSet::K_WEIGHTING, double[5]> hpCoeffs{0, 0, 0, 0, 0};
+    Optional<FeatureSet::K_WEIGHTING, double[5]> hsCoeffs{0, 0, 0, 0, 0};
+
+    // Block processing scratch (interleaved K-weighted frames, audio thread only)
+    alignas(SIMD::VECTOR_ALIGNMENT)
+    Optional<FeatureSet::K_WEIGHTING, FilterType[ProcessorSSOT::Buffer::PROCESS_CHUNK_SIZE * FilterBank::MAX_STRIDE]> segmentFrames{};
+
+    // ---- Published: read by the UI thread ----
+    // Seqlocked meter frame on its own cache lines, written at most once per host block
+    BasicMeterFrameSeqlock<FeatureSet> published;
 
     // ========================================================================
     // PRIVATE METHODS
     // ========================================================================
 
     /**
-     * Update block size based on sample rate
+     * Update sub-block (gating hop) size based on sample rate
      */
     void updateBlockSize() noexcept
     {
-        blockSize = DSPSSOT::Helpers::calculateBlockSize(sampleRate);
+        subBlockSize = DSPSSOT::Helpers::calculateSubBlockSize(sampleRate);
+    }
+
+    /**
+     * Select the loudness path's decimation factor (1 unless high-rate mode is on)
+     * Hops stay whole numbers of decimated frames (see Helpers::highRateDecimationFactor)
+     */
+    void updateDecimation() noexcept
+    {
+        if constexpr (FeatureSet::K_WEIGHTING)
+        {
+            decimationFactor = highRateDecimation ? DSPSSOT::Helpers::highRateDecimationFactor(sampleRate) : 1;
+            decimator.setFactor(decimationFactor);
+        }
+        energySubBlockSize = subBlockSize / decimationFactor;
+    }
+
+    /**
+     * Select True Peak oversampling from the sample rate (4x / 2x / 1x)
+     */
+    void updateTruePeakOversampling() noexcept
+    {
+        if constexpr (FeatureSet::TRUE_PEAK)
+            truePeak.setOversamplingFactor(DSPSSOT::Helpers::truePeakOversamplingFactor(sampleRate));
     }
 
     /**
@@ -247,10 +627,12 @@ private:
      */
     void resetFilters() noexcept
     {
-        hpStateL[0] = hpStateL[1] = hpStateL[2] = hpStateL[3] = 0;
-        hpStateR[0] = hpStateR[1] = hpStateR[2] = hpStateR[3] = 0;
-        hsStateL[0] = hsStateL[1] = hsStateL[2] = hsStateL[3] = 0;
-        hsStateR[0] = hsStateR[1] = hsStateR[2] = hsStateR[3] = 0;
+        if constexpr (FeatureSet::K_WEIGHTING)
+        {
+            kWeighting.reset();
+            blockFilter.reset();
+            decimator.reset();
+        }
 
         recalculateFilterCoefficients();
     }
@@ -262,22 +644,31 @@ private:
      */
     void recalculateFilterCoefficients() noexcept
     {
-        // High-pass coefficients (same for both channels)
-        DSPSSOT::Helpers::calculateHighPassCoeffs(
-            DSPSSOT::KWeighting::HIGH_PASS_FC,
-            DSPSSOT::KWeighting::HIGH_PASS_Q,
-            sampleRate,
-            hpCoeffs
-        );
-
-        // High-shelf coefficients (same for both channels)
-        DSPSSOT::Helpers::calculateHighShelfCoeffs(
-            DSPSSOT::KWeighting::HIGH_SHELF_FC,
-            DSPSSOT::KWeighting::HIGH_SHELF_Q,
-            DSPSSOT::KWeighting::HIGH_SHELF_GAIN_DB,
-            sampleRate,
-            hsCoeffs
-        );
+        if constexpr (FeatureSet::K_WEIGHTING)
+        {
+            // K-weighting runs at the decimated rate in high-rate mode
+            const double filterRate = sampleRate / decimationFactor;
+
+            // High-pass coefficients (same for both channels)
+            DSPSSOT::Helpers::calculateHighPassCoeffs(
+                DSPSSOT::KWeighting::HIGH_PASS_FC,
+                DSPSSOT::KWeighting::HIGH_PASS_Q,
+                filterRate,
+                hpCoeffs
+            );
+
+            // High-shelf coefficients (same for both channels)
+            DSPSSOT::Helpers::calculateHighShelfCoeffs(
+                DSPSSOT::KWeighting::HIGH_SHELF_FC,
+                DSPSSOT::KWeighting::HIGH_SHELF_Q,
+                DSPSSOT::KWeighting::HIGH_SHELF_GAIN_DB,
+                filterRate,
+                hsCoeffs
+            );
+
+            kWeighting.setCoefficients(hpCoeffs, hsCoeffs);
+            blockFilter.setCoefficients(hpCoeffs, hsCoeffs);
+        }
     }
 
     /**
@@ -285,13 +676,28 @@ private:
      */
     void resetIntegration() noexcept
     {
-        blockAccumulator = 0.0;
-        blockCount = 0;
-        energySum = 0.0;
-        sampleSum.store(0);
-        totalSamplesProcessed.store(0);
-        integratedLUFS.store(DSPSSOT::TruePeak::MIN_DISPLAY_DB);
-        deviationLU.store(0.0);
+        subBlockAccumulator = 0;
+        subBlockCount = 0;
+        hopSamplePeak = 0.0;
+        hopChannels = 0;
+        if constexpr (FeatureSet::K_WEIGHTING)
+            for (AccumulatorType& e : subBlockEnergy)
+                e = 0;
+        subBlockRingIndex = 0;
+        subBlocksFilled = 0;
+        momentarySum = 0;
+        shortTermSum = 0;
+        if constexpr (FeatureSet::INTEGRATED)
+            blockHistogram.reset();
+        if constexpr (FeatureSet::LOUDNESS_RANGE)
+            shortTermHistogram.reset();
+        relativeGateEnergy = std::numeric_limits<double>::infinity();
+        const double peak = meters.truePeak;  // True Peak has its own reset
+        meters = MeterLevels{};
+        meters.truePeak = peak;
+        meters.contentType = getContentType();
+        metersDirty = true;
+        publishFrame();
     }
 
     /**
@@ -299,284 +705,423 @@ private:
      */
     void resetTruePeak() noexcept
     {
-        tpLeftBuffer[0] = tpLeftBuffer[1] = tpLeftBuffer[2] = tpLeftBuffer[3] = 0;
-        tpRightBuffer[0] = tpRightBuffer[1] = tpRightBuffer[2] = tpRightBuffer[3] = 0;
-        tpPeakLeft = 0.0;
-        tpPeakRight = 0.0;
-        tpPeakMax = 0.0;
-        tpBufferedDB = DSPSSOT::TruePeak::MIN_DISPLAY_DB;
+        if constexpr (FeatureSet::TRUE_PEAK)
+            truePeak.reset();
+        tpBufferedPeak = 0.0;
         tpUpdateCounter = 0;
-        truePeakDB.store(DSPSSOT::TruePeak::MIN_DISPLAY_DB);
+        publishFrame();
     }
 
     /**
-     * Apply K-weighting to left channel
-     * K-weighting chain: High-pass (60Hz) -> High-shelf (4kHz, +4dB)
-     * Matches JSFX reference: y = b0*x + b1*x1 + b2*x2 - a1*y1 - a2*y2
+     * Flush NaN/infinity and denormal input samples to zero (branch-free:
+     * NaN fails both comparisons)
      */
-    double applyKWeightingLeft(double sample) noexcept
+    static FilterType sanitizeInput(FilterType sample) noexcept
     {
-        const double* hp = hpCoeffs;
-        const double* hs = hsCoeffs;
+        const FilterType magnitude = std::abs(sample);
+        const bool valid = magnitude >= static_cast<FilterType>(DSPSSOT::TruePeak::DENORM_THRESHOLD)
+                        && magnitude <= std::numeric_limits<FilterType>::max();
+        return valid ? sample : FilterType(0);
+    }
 
-        // HP biquad: y[n] = b0*x[n] + b1*x[n-1] + b2*x[n-2] - a1*y[n-1] - a2*y[n-2]
-        double yHP = hp[0] * sample + hp[1] * hpStateL[0] + hp[2] * hpStateL[1]
-                   - hp[3] * hpStateL[2] - hp[4] * hpStateL[3];
+    /**
+     * Flush NaN/infinity K-weighted samples to zero
+     */
+    static AccumulatorType sanitizeFiltered(FilterType sample) noexcept
+    {
+        const bool finite = std::abs(sample) <= std::numeric_limits<FilterType>::max();  // false for NaN
+        return static_cast<AccumulatorType>(finite ? sample : FilterType(0));
+    }
 
-        // Update HP states: [0]=x[n-1], [1]=x[n-2], [2]=y[n-1], [3]=y[n-2]
-        hpStateL[1] = hpStateL[0];
-        hpStateL[0] = sample;
-        hpStateL[3] = hpStateL[2];
-        hpStateL[2] = yHP;
+    /**
+     * Weighted energy of one K-weighted frame: sum of G_i * y_i^2
+     * EDGE CASE: NaN/infinity filter outputs are flushed to zero
+     */
+    AccumulatorType frameEnergy(const FilterType* frame, int numChannels) const noexcept
+    {
+        AccumulatorType energy = 0;
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            const AccumulatorType y = sanitizeFiltered(frame[ch]);
+            energy += channelWeights[ch] * y * y;
+        }
+        return energy;
+    }
 
-        // HS biquad: input is HP output, using HS's own input/output history
-        double yHS = hs[0] * yHP + hs[1] * hsStateL[0] + hs[2] * hsStateL[1]
-                   - hs[3] * hsStateL[2] - hs[4] * hsStateL[3];
+    /**
+     * Process a segment that lies entirely inside one 100 ms sub-block
+     * Each stage runs as its own loop over the segment (sanitize, filter, energy, True Peak)
+     */
+    template<typename SampleType>
+    void processSegment(const SampleType* const* channels, int numChannels, int offset, int numSamples) noexcept
+    {
+        if constexpr (FeatureSet::K_WEIGHTING)
+            accumulateSegmentEnergy(channels, numChannels, offset, numSamples);
 
-        // Update HS states: [0]=x[n-1] (HP output), [1]=x[n-2], [2]=y[n-1], [3]=y[n-2]
-        hsStateL[1] = hsStateL[0];
-        hsStateL[0] = yHP;
-        hsStateL[3] = hsStateL[2];
-        hsStateL[2] = yHS;
+        // True Peak on ORIGINAL input samples (publication happens in processBlock)
+        // Runs before the hop check so this segment lands in its hop's history record
+        if constexpr (FeatureSet::TRUE_PEAK)
+            for (int ch = 0; ch < numChannels; ++ch)
+                truePeak.process(ch, channels[ch] + offset, numSamples);
 
-        return yHS;
+        advanceSegment(numSamples);
+    }
+
+    /**
+     * Count a processed (or skipped silent) segment and close the sub-block at its boundary
+     */
+    void advanceSegment(int numSamples) noexcept
+    {
+        subBlockCount += numSamples;
+        meters.samplePosition += numSamples;
+
+        if (subBlockCount >= subBlockSize && subBlockSize > 0)
+            completeSubBlock();
+    }
+
+    /**
+     * Frames at the start of a segment where every channel sanitizes to zero
+     * (infinity is not counted: it is rare and the full path flushes it)
+     */
+    template<typename SampleType>
+    static int leadingSilence(const SampleType* const* channels, int numChannels, int offset, int numSamples) noexcept
+    {
+        const auto threshold = static_cast<SampleType>(DSPSSOT::TruePeak::DENORM_THRESHOLD);
+        int silent = numSamples;
+        for (int ch = 0; ch < numChannels && silent > 0; ++ch)
+            silent = SIMD::leadingRunBelow(channels[ch] + offset, silent, threshold);
+        return silent;
+    }
+
+    /**
+     * At a hop boundary: flush filter state that has decayed below the
+     * denormal threshold and report whether the filter and True Peak
+     * histories of the first numChannels channels are now all zero.
+     * Hop boundaries are the same in every processing path, so the flush
+     * never depends on host buffer sizes.
+     */
+    bool settleHistories(int numChannels) noexcept
+    {
+        bool settled = true;
+        if constexpr (FeatureSet::K_WEIGHTING)
+        {
+            const auto threshold = static_cast<FilterType>(DSPSSOT::TruePeak::DENORM_THRESHOLD);
+            settled = blockParallelKWeighting ? blockFilter.flushDecayed(numChannels, threshold)
+                                              : kWeighting.flushDecayed(numChannels, threshold);
+            settled = decimator.flushDecayed(numChannels, threshold) && settled;
+        }
+        if constexpr (FeatureSet::TRUE_PEAK)
+            settled = settled && truePeak.isHistorySilent(numChannels);
+        return settled;
     }
 
     /**
-     * Apply K-weighting to right channel
-     * Matches JSFX reference: y = b0*x + b1*x1 + b2*x2 - a1*y1 - a2*y2
+     * Sanitize, decimate (high-rate mode), K-weight and sum the weighted energy of one segment
      */
-    double applyKWeightingRight(double sample) noexcept
+    template<typename SampleType>
+    void accumulateSegmentEnergy(const SampleType* const* channels, int numChannels, int offset, int numSamples) noexcept
     {
-        const double* hp = hpCoeffs;
-        const double* hs = hsCoeffs;
+        const int stride = SIMD::roundUpToLanes(numChannels, FilterBank::LANES);
+        FilterType* frames = segmentFrames;
 
-        // HP biquad: y[n] = b0*x[n] + b1*x[n-1] + b2*x[n-2] - a1*y[n-1] - a2*y[n-2]
-        double yHP = hp[0] * sample + hp[1] * hpStateR[0] + hp[2] * hpStateR[1]
-                   - hp[3] * hpStateR[2] - hp[4] * hpStateR[3];
+        // Sanitize whole segment in one pass, interleaving channels into SIMD lanes
+        // (and track this hop's sample peak for the history stream)
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            const SampleType* in = channels[ch] + offset;
+            FilterType samplePeak = 0;
+            for (int i = 0; i < numSamples; ++i)
+            {
+                const FilterType x = sanitizeInput(static_cast<FilterType>(in[i]));
+                frames[i * stride + ch] = x;
+                if constexpr (FeatureSet::STATS)
+                    samplePeak = std::max(samplePeak, std::abs(x));
+            }
+            if constexpr (FeatureSet::STATS)
+                hopSamplePeak = std::max(hopSamplePeak, static_cast<double>(samplePeak));
+        }
 
-        // Update HP states: [0]=x[n-1], [1]=x[n-2], [2]=y[n-1], [3]=y[n-2]
-        hpStateR[1] = hpStateR[0];
-        hpStateR[0] = sample;
-        hpStateR[3] = hpStateR[2];
-        hpStateR[2] = yHP;
+        // Padding lanes stay silent
+        for (int ch = numChannels; ch < stride; ++ch)
+            for (int i = 0; i < numSamples; ++i)
+                frames[i * stride + ch] = 0;
 
-        // HS biquad: input is HP output, using HS's own input/output history
-        double yHS = hs[0] * yHP + hs[1] * hsStateR[0] + hs[2] * hsStateR[1]
-                   - hs[3] * hsStateR[2] - hs[4] * hsStateR[3];
+        // High-rate mode: halfband decimation in place (numFrames = numSamples otherwise)
+        const int numFrames = decimator.processFrames(frames, stride, numSamples);
 
-        // Update HS states: [0]=x[n-1] (HP output), [1]=x[n-2], [2]=y[n-1], [3]=y[n-2]
-        hsStateR[1] = hsStateR[0];
-        hsStateR[0] = yHP;
-        hsStateR[3] = hsStateR[2];
-        hsStateR[2] = yHS;
+        // K-weighting (channels packed into SIMD lanes, or block-parallel per channel)
+        kWeightFrames(frames, stride, numChannels, numFrames);
 
-        return yHS;
+        // Energy accumulation (same summation order as the per-sample path)
+        AccumulatorType accumulator = subBlockAccumulator;
+        for (int i = 0; i < numFrames; ++i)
+            accumulator += sanitizeEnergy(frameEnergy(frames + i * stride, numChannels));
+        subBlockAccumulator = accumulator;
+    }
+
+    /**
+     * K-weight interleaved frames in place with the selected filter
+     */
+    void kWeightFrames(FilterType* frames, int stride, int numChannels, int numFrames) noexcept
+    {
+        if (blockParallelKWeighting)
+            blockFilter.processFrames(frames, stride, numChannels, numFrames);
+        else
+            kWeighting.processFrames(frames, stride, numFrames);
+    }
+
+    /**
+     * EDGE CASE: Handle invalid energy values
+     */
+    static AccumulatorType sanitizeEnergy(AccumulatorType energy) noexcept
+    {
+        const bool valid = energy >= 0 && energy <= std::numeric_limits<AccumulatorType>::max();  // false for NaN
+        return valid ? energy : AccumulatorType(0);
     }
 
     /**
      * Accumulate energy for gated integration
      * Optimized: reduced branching, cached atomic loads
      */
-    void accumulateEnergy(double energy) noexcept
+    void accumulateEnergy(AccumulatorType energy) noexcept
     {
-        // EDGE CASE: Handle invalid energy values
-        if (std::isnan(energy) || std::isinf(energy) || energy < 0.0)
+        // Accumulate energy
+        if constexpr (FeatureSet::K_WEIGHTING)
+            subBlockAccumulator += sanitizeEnergy(energy);
+        subBlockCount++;
+
+        if (subBlockCount >= subBlockSize && subBlockSize > 0)
         {
-            energy = 0.0;
+            completeSubBlock();
+            publishFrame();  // per-sample path has no block end
         }
+    }
 
-        // Accumulate energy
-        blockAccumulator += energy;
-        blockCount++;
+    /**
+     * Close the current 100 ms sub-block
+     * Slides the momentary (400 ms) and short-term (3 s) windows by one hop:
+     * each running sum adds the new sub-block and drops the one leaving its
+     * window - O(1), no re-filtering. The sums are recomputed exactly each
+     * time the ring wraps (every 3 s) so rounding error cannot accumulate.
+     */
+    void completeSubBlock() noexcept
+    {
+        // Silence fast path resumes once the histories have settled
+        if (silentChannels < hopChannels)
+            silentChannels = settleHistories(hopChannels) ? hopChannels : 0;
+        hopChannels = 0;
 
-        if (blockCount >= blockSize && blockSize > 0)
+        if constexpr (FeatureSet::K_WEIGHTING)
         {
-            // Process complete block
-            double blockMean = blockAccumulator / blockCount;
+            const AccumulatorType energy = subBlockAccumulator;
 
-            // EDGE CASE: Handle very small or zero block mean
-            double blockLUFS = (blockMean <= DSPSSOT::TruePeak::DENORM_THRESHOLD)
-                ? DSPSSOT::TruePeak::MIN_DISPLAY_DB
-                : DSPSSOT::GatedIntegration::K_OFFSET_DB + 10.0 * std::log10(blockMean);
+            // Slots leaving the windows (still zero while the ring is filling)
+            const int momentaryTail = (subBlockRingIndex + SUB_BLOCK_RING_SIZE - MOMENTARY_SUB_BLOCKS) % SUB_BLOCK_RING_SIZE;
+            momentarySum += energy - subBlockEnergy[momentaryTail];
+            shortTermSum += energy - subBlockEnergy[subBlockRingIndex];
 
-            // Calculate gate threshold using absolute or relative gate
-            // Matches JSFX: gate_rel=(L_int<=NEG_INF_THR ? -70 : L_int - 10)
-            double currentLUFS = integratedLUFS.load();
-            double gateThr;
+            subBlockEnergy[subBlockRingIndex] = energy;
+        }
+        subBlockRingIndex = (subBlockRingIndex + 1) % SUB_BLOCK_RING_SIZE;
+        subBlocksFilled = std::min(subBlocksFilled + 1, SUB_BLOCK_RING_SIZE);
 
-            if (currentLUFS <= DSPSSOT::TruePeak::NEG_INF_THRESHOLD)
-            {
-                // No valid measurement yet - use absolute gate only
-                gateThr = DSPSSOT::GatedIntegration::GATE_ABS_DB;
-            }
-            else
-            {
-                // Use relative gate (L - 10 LU)
-                double gateRel = currentLUFS - DSPSSOT::GatedIntegration::GATE_REL_OFFSET_DB;
-                gateThr = std::max(DSPSSOT::GatedIntegration::GATE_ABS_DB, gateRel);
-            }
+        if constexpr (FeatureSet::K_WEIGHTING)
+            if (subBlockRingIndex == 0)
+                resyncWindowSums();
 
-            // Gate: include block if above threshold
-            if (blockLUFS >= gateThr)
-            {
-                energySum += blockAccumulator;
-                sampleSum.store(sampleSum.load() + blockCount);
-            }
+        // Track total samples processed (for transport freeze detection)
+        meters.totalSamplesProcessed += subBlockCount;
+        metersDirty = true;
 
-            // Track total samples processed (for transport freeze detection)
-            totalSamplesProcessed.store(totalSamplesProcessed.load() + blockCount);
+        // Reset sub-block accumulator
+        subBlockAccumulator = 0;
+        subBlockCount = 0;
 
-            // Reset block accumulator
-            blockAccumulator = 0.0;
-            blockCount = 0;
+        bool gated = false;
+        if (subBlocksFilled >= MOMENTARY_SUB_BLOCKS)
+        {
+            if constexpr (FeatureSet::INTEGRATED)
+                gated = completeGatingBlock();
+            if constexpr (FeatureSet::MOMENTARY_SHORT_TERM)
+                updateMomentary();
+        }
 
-            // Calculate integrated LUFS
-            if (sampleSum > 0)
-            {
-                double meanAll = energySum / sampleSum;
+        if constexpr (FeatureSet::MOMENTARY_SHORT_TERM || FeatureSet::LOUDNESS_RANGE)
+            if (subBlocksFilled == SUB_BLOCK_RING_SIZE)
+                updateShortTerm();
 
-                // EDGE CASE: Handle very small meanAll
-                double clampedMean = std::max(meanAll, DSPSSOT::TruePeak::DENORM_THRESHOLD);
+        if constexpr (FeatureSet::STATS)
+            pushHistoryRecord(gated);
+    }
 
-                // EDGE CASE: Check for NaN in log10 calculation
-                double newLUFS;
-                if (std::isnan(clampedMean) || clampedMean <= 0.0)
-                {
-                    newLUFS = DSPSSOT::TruePeak::MIN_DISPLAY_DB;
-                }
-                else
-                {
-                    // Apply K-offset + JSFX calibration offset
-                    newLUFS = DSPSSOT::GatedIntegration::K_OFFSET_DB +
-                              10.0 * std::log10(clampedMean) +
-                              DSPSSOT::GatedIntegration::JSFX_CALIBRATION_OFFSET_DB;
-                }
+    /**
+     * Queue this hop's record for history readers (wait-free; dropped if the stream is full)
+     */
+    void pushHistoryRecord(bool gated) noexcept
+    {
+        LoudnessHopRecord record;
+        record.samplePosition = meters.samplePosition;
+        record.momentaryEnergy = windowMean(momentarySum, MOMENTARY_SUB_BLOCKS);
+        record.samplePeak = static_cast<float>(hopSamplePeak);
+        if constexpr (FeatureSet::TRUE_PEAK)
+            record.truePeak = static_cast<float>(truePeak.takeWindowPeak());
+        record.gated = gated;
+        history.push(record);
+
+        hopSamplePeak = 0.0;
+    }
 
-                // EDGE CASE: Clamp to valid range
-                newLUFS = std::max(newLUFS, DSPSSOT::TruePeak::MIN_DISPLAY_DB);
-                newLUFS = std::min(newLUFS, DSPSSOT::TruePeak::MAX_DISPLAY_DB);
+    /**
+     * Recompute the window sums from the ring (called when the ring wraps, index 0)
+     */
+    void resyncWindowSums() noexcept
+    {
+        momentarySum = 0;
+        for (int i = SUB_BLOCK_RING_SIZE - MOMENTARY_SUB_BLOCKS; i < SUB_BLOCK_RING_SIZE; ++i)
+            momentarySum += subBlockEnergy[i];
 
-                integratedLUFS.store(newLUFS);
+        shortTermSum = 0;
+        for (AccumulatorType e : subBlockEnergy)
+            shortTermSum += e;
+    }
 
-                // Calculate deviation from target
-                double dev = newLUFS - targetLUFS;
-                constexpr double MAX_DEVIATION = 50.0; // Clamp to ±50 LU
-                dev = std::max(dev, -MAX_DEVIATION);
-                dev = std::min(dev, MAX_DEVIATION);
-                deviationLU.store(dev);
-            }
-            else
-            {
-                // EDGE CASE: No blocks exceeded gate threshold
-                integratedLUFS.store(DSPSSOT::TruePeak::MIN_DISPLAY_DB);
-                deviationLU.store(0.0);
-            }
-        }
+    /**
+     * Windowed mean energy; running sums may round slightly below zero after a loud-to-silent step
+     */
+    double windowMean(AccumulatorType windowSum, int numSubBlocks) const noexcept
+    {
+        return std::max(static_cast<double>(windowSum), 0.0) / (static_cast<double>(numSubBlocks) * energySubBlockSize);
     }
 
     /**
-     * Update True Peak with 4x Hermite interpolation
-     * Optimized: cached tValues, reduced branching in hot path
+     * Publish momentary loudness (ungated, 400 ms) and its maximum
      */
-    template<typename SampleType>
-    void updateTruePeak(SampleType left, SampleType right) noexcept
-    {
-        // Shift buffers (optimized: manual copy is faster than memcpy for small arrays)
-        tpLeftBuffer[0] = tpLeftBuffer[1];
-        tpLeftBuffer[1] = tpLeftBuffer[2];
-        tpLeftBuffer[2] = tpLeftBuffer[3];
-        tpLeftBuffer[3] = static_cast<double>(left);
-
-        tpRightBuffer[0] = tpRightBuffer[1];
-        tpRightBuffer[1] = tpRightBuffer[2];
-        tpRightBuffer[2] = tpRightBuffer[3];
-        tpRightBuffer[3] = static_cast<double>(right);
-
-        // Hermite interpolation for 4x oversampling using cached tValues
-        static constexpr double tValues[4] = {0.00, 0.25, 0.50, 0.75};
-
-        // Unrolled interpolation loop for better instruction pipelining
-        double tpL0 = hermiteInterpolate(tpLeftBuffer[0], tpLeftBuffer[1], tpLeftBuffer[2], tpLeftBuffer[3], tValues[0]);
-        double tpL1 = hermiteInterpolate(tpLeftBuffer[0], tpLeftBuffer[1], tpLeftBuffer[2], tpLeftBuffer[3], tValues[1]);
-        double tpL2 = hermiteInterpolate(tpLeftBuffer[0], tpLeftBuffer[1], tpLeftBuffer[2], tpLeftBuffer[3], tValues[2]);
-        double tpL3 = hermiteInterpolate(tpLeftBuffer[0], tpLeftBuffer[1], tpLeftBuffer[2], tpLeftBuffer[3], tValues[3]);
-
-        double tpR0 = hermiteInterpolate(tpRightBuffer[0], tpRightBuffer[1], tpRightBuffer[2], tpRightBuffer[3], tValues[0]);
-        double tpR1 = hermiteInterpolate(tpRightBuffer[0], tpRightBuffer[1], tpRightBuffer[2], tpRightBuffer[3], tValues[1]);
-        double tpR2 = hermiteInterpolate(tpRightBuffer[0], tpRightBuffer[1], tpRightBuffer[2], tpRightBuffer[3], tValues[2]);
-        double tpR3 = hermiteInterpolate(tpRightBuffer[0], tpRightBuffer[1], tpRightBuffer[2], tpRightBuffer[3], tValues[3]);
-
-        // Track peak values: absolute for detection, per-sample peak
-        double samplePeakL = std::max(std::abs(tpL0), std::max(std::abs(tpL1), std::max(std::abs(tpL2), std::abs(tpL3))));
-        double samplePeakR = std::max(std::abs(tpR0), std::max(std::abs(tpR1), std::max(std::abs(tpR2), std::abs(tpR3))));
-
-        // Running maximum (matches JSFX: tp_peak_l = max(tp_peak_l, pL))
-        // True Peak only ever increases — never resets per sample
-        tpPeakLeft = std::max(tpPeakLeft, samplePeakL);
-        tpPeakRight = std::max(tpPeakRight, samplePeakR);
-
-        // Calculate max peak across channels (running max)
-        tpPeakMax = std::max(tpPeakLeft, tpPeakRight);
-
-        // EDGE CASE: Clamp peak to prevent overflow
-        constexpr double MAX_PEAK = 1e10;
-        if (tpPeakMax > MAX_PEAK)
-        {
-            tpPeakMax = MAX_PEAK;
-        }
+    void updateMomentary() noexcept
+    {
+        const double meanEnergy = windowMean(momentarySum, MOMENTARY_SUB_BLOCKS);
+        meters.momentaryEnergy = meanEnergy;
+        meters.maxMomentaryEnergy = std::max(meters.maxMomentaryEnergy, meanEnergy);
+    }
+
+    /**
+     * Publish short-term loudness (ungated, 3 s), its maximum and LRA
+     * LRA is re-read from the short-term histogram once per 100 ms hop
+     * (10 Hz, below the UI refresh rate) in O(bins)
+     */
+    void updateShortTerm() noexcept
+    {
+        const double meanEnergy = windowMean(shortTermSum, SUB_BLOCK_RING_SIZE);
 
-        // Convert to dB with proper handling of edge cases
-        double tpDB;
-        if (tpPeakMax <= DSPSSOT::TruePeak::DENORM_THRESHOLD)
+        if constexpr (FeatureSet::LOUDNESS_RANGE)
         {
-            tpDB = DSPSSOT::TruePeak::MIN_DISPLAY_DB;
+            shortTermHistogram.add(meanEnergy);
+            updateLoudnessRange();
         }
-        else if (std::isnan(tpPeakMax) || std::isinf(tpPeakMax))
+
+        if constexpr (FeatureSet::MOMENTARY_SHORT_TERM)
         {
-            // Invalid peak value - show minimum
-            tpDB = DSPSSOT::TruePeak::MIN_DISPLAY_DB;
+            meters.shortTermEnergy = meanEnergy;
+            meters.maxShortTermEnergy = std::max(meters.maxShortTermEnergy, meanEnergy);
         }
-        else
+    }
+
+    /**
+     * EBU Tech 3342: absolute gate (-70 LUFS), relative gate (-20 LU), P95 - P10
+     */
+    void updateLoudnessRange() noexcept
+    {
+        meters.loudnessRangeLU = shortTermHistogram.percentileRange(
+            DSPSSOT::LoudnessRange::GATE_REL_ENERGY_FACTOR,
+            DSPSSOT::LoudnessRange::LOW_PERCENTILE,
+            DSPSSOT::LoudnessRange::HIGH_PERCENTILE);
+    }
+
+    /**
+     * Close the current 400 ms gating block and update integrated loudness
+     * The gating block is the momentary window; gating is exact two-pass
+     * BS.1770: the block histogram is re-gated against the current relative
+     * threshold every time a block completes
+     * Returns true if the new block passes both gates
+     */
+    bool completeGatingBlock() noexcept
+    {
+        // Process complete block: store its mean energy (absolute gate applied inside)
+        const double blockEnergy = windowMean(momentarySum, MOMENTARY_SUB_BLOCKS);
+        blockHistogram.add(blockEnergy);
+        updateIntegrated();
+
+        // Same test as LoudnessHistogram::passesGates, against the cached gate
+        return blockEnergy >= relativeGateEnergy;
+    }
+
+    /**
+     * Integrated loudness and deviation from the block histogram
+     */
+    void updateIntegrated() noexcept
+    {
+        // Two-pass gating: absolute gate (-70 LUFS), then relative gate (L - 10 LU)
+        const LoudnessHistogram::Gated gated =
+            blockHistogram.gatedMean(DSPSSOT::GatedIntegration::GATE_REL_ENERGY_FACTOR);
+
+        // Gated blocks x hop size: samples represented by gated blocks
+        meters.sampleSum = gated.count * subBlockSize;
+
+        // Integrated energy (readers convert to LUFS and derive deviation)
+        // EDGE CASE: No blocks exceeded gate threshold (mean energy 0 = display floor)
+        meters.integratedEnergy = gated.meanEnergy;
+        relativeGateEnergy = gated.gateEnergy;
+    }
+
+    /**
+     * Update True Peak (polyphase FIR)
+     * Optimized: batched atomic publication every TP_BATCH_SIZE samples (also while silent)
+     */
+    template<typename SampleType>
+    void updateTruePeak(SampleType left, SampleType right, bool silent) noexcept
+    {
+        // Silence on a silent history interpolates to zero: peaks are unchanged
+        if (!silent)
         {
-            tpDB = 20.0 * std::log10(tpPeakMax);
+            truePeak.process(0, &left, 1);
+            truePeak.process(1, &right, 1);
         }
 
-        // Clamp to valid display range
-        tpDB = std::max(tpDB, DSPSSOT::TruePeak::MIN_DISPLAY_DB);
-        tpDB = std::min(tpDB, DSPSSOT::TruePeak::MAX_DISPLAY_DB);
-
         // Batched atomic update: only update UI every TP_BATCH_SIZE samples
-        tpBufferedDB = tpDB; // Always track latest value
+        tpBufferedPeak = truePeak.getPeak(); // Always track latest value (linear, no log10)
         tpUpdateCounter++;
 
         if (tpUpdateCounter >= TP_BATCH_SIZE)
         {
-            truePeakDB.store(tpBufferedDB);
+            publishFrame();
             tpUpdateCounter = 0;
         }
     }
 
     /**
-     * Hermite interpolation for smooth curve between samples
+     * Publish the audio-side meter frame (seqlock write, skipped if nothing changed)
+     * A content type change is applied here, so deviation (derived by
+     * readers) and content type in a published frame always belong together
      */
-    static double hermiteInterpolate(double x0, double x1, double x2, double x3, double t) noexcept
+    void publishFrame() noexcept
     {
-        double t2 = t * t;
-        double t3 = t2 * t;
-
-        double a = -0.5 * x0 + 1.5 * x1 - 1.5 * x2 + 0.5 * x3;
-        double b = x0 - 2.5 * x1 + 2.0 * x2 - 0.5 * x3;
-        double c = -0.5 * x0 + 0.5 * x2;
-        double d = x1;
+        const ModelSSOT::ContentType type = getContentType();
+        if (type != meters.contentType)
+        {
+            meters.contentType = type;
+            metersDirty = true;
+        }
 
-        double y = a * t3 + b * t2 + c * t + d;
+        if (tpBufferedPeak != meters.truePeak)
+        {
+            meters.truePeak = tpBufferedPeak;
+            metersDirty = true;
+        }
 
-        // Denormal handling
-        if (std::abs(y) < DSPSSOT::TruePeak::DENORM_THRESHOLD || std::isnan(y))
-            y = 0.0;
+        if (!metersDirty)
+            return;
 
-        return y;
+        published.write(meters);
+        metersDirty = false;
     }
 
     // ========================================================================
@@ -590,6 +1135,8 @@ private:
 // The atomics are used solely for thread-safe UI reads and don't affect DSP correctness.
 static_assert(std::is_trivially_copyable_v<double>, "DSP state types must be trivially copyable");
 static_assert(std::is_trivially_copyable_v<ModelSSOT::ContentType>, "ContentType must be trivially copyable");
+static_assert(alignof(BULLsEYEProcessorCore) == ProcessorSSOT::Performance::CACHE_LINE_PADDING,
+              "Core must start on a cache line so hot state and published atomics never share one");
 
 // ============================================================================
 // TETRIS COMPLIANCE CHECKLIST
@@ -611,10 +1158,12 @@ T - Trivially Copyable
 
 R - Reference Processing
    ✅ template<typename SampleType> void process(SampleType& left, SampleType& right)
+   ✅ template<typename SampleType> void processBlock(const SampleType* left, const SampleType* right, int numSamples)
    ✅ In-place processing
 
 I - Internal Double
-   ✅ Process in double precision internally
+   ✅ Process in double precision internally (BULLsEYEProcessorCore)
+   ✅ Reduced-precision filters / sums only by explicit PrecisionPolicy
    ✅ Convert back to sample type
 
 S - Smoothing (parameter transitions)
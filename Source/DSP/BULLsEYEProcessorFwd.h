@@ -0,0 +1,13 @@
+#pragma once
+
+#include "FeaturePolicy.h"
+#include "PrecisionPolicy.h"
+
+/**
+ * Forward declarations of the DSP core (see BULLsEYEProcessor.h)
+ */
+template<typename PrecisionPolicy = Precision::Double, typename FeatureSet = Features::All>
+class BasicBULLsEYEProcessorCore;
+
+// The reference core used by the plugin: double precision, every meter
+using BULLsEYEProcessorCore = BasicBULLsEYEProcessorCore<>;
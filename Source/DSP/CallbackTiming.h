@@ -0,0 +1,300 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include "../SSOT/ProcessorSSOT.h"
+
+// Audio-thread callback timing; off unless the build defines it to 1
+// (cmake -DBULLSEYE_ENABLE_TIMING=ON). Disabled builds keep no timer state
+// and make no clock calls in processBlock.
+#ifndef BULLSEYE_ENABLE_TIMING
+    #define BULLSEYE_ENABLE_TIMING 0
+#endif
+
+/**
+ * Log-Bucket Histogram - single writer, lock-free readers
+ *
+ * Values below 2^(SUB_BITS + 1) get one bucket each; above that every
+ * octave is split into 2^SUB_BITS equal buckets, so a bucket is at most
+ * 2^-SUB_BITS of its value wide and the whole uint64 range fits in a
+ * fixed array. add() is wait-free: relaxed load + store of counters only
+ * the writer modifies (no read-modify-write, no allocation).
+ * Readers may run concurrently; a snapshot can be a few values behind.
+ */
+class LogBucketHistogram
+{
+public:
+    static constexpr int SUB_BITS = ProcessorSSOT::Timing::HISTOGRAM_SUB_BUCKET_BITS;
+    static constexpr int SUB_BUCKETS = 1 << SUB_BITS;
+    static constexpr int NUM_BUCKETS = (65 - SUB_BITS) * SUB_BUCKETS;
+
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "Histogram counters must be lock-free atomics");
+
+    using Counts = std::array<std::uint64_t, NUM_BUCKETS>;
+
+    static constexpr int bucketFor(std::uint64_t value) noexcept
+    {
+        const int shift = highestBit(value) - SUB_BITS;
+        return shift <= 0 ? static_cast<int>(value)
+                          : shift * SUB_BUCKETS + static_cast<int>(value >> shift);
+    }
+
+    /**
+     * Smallest value that no longer falls into the bucket
+     */
+    static constexpr double bucketUpperBound(int bucket) noexcept
+    {
+        if (bucket < 2 * SUB_BUCKETS)
+            return bucket + 1.0;
+
+        const int shift = bucket / SUB_BUCKETS - 1;
+        const int mantissa = bucket - shift * SUB_BUCKETS;
+        return static_cast<double>(mantissa + 1) * static_cast<double>(std::uint64_t{1} << shift);
+    }
+
+    // ========================================================================
+    // WRITER
+    // ========================================================================
+
+    void add(std::uint64_t value) noexcept
+    {
+        auto& bucket = counts[static_cast<size_t>(bucketFor(value))];
+        bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        total.store(total.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        sum.store(sum.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        if (value > max.load(std::memory_order_relaxed))
+            max.store(value, std::memory_order_relaxed);
+    }
+
+    /**
+     * Clear every counter (not while add() may run)
+     */
+    void reset() noexcept
+    {
+        for (auto& bucket : counts)
+            bucket.store(0, std::memory_order_relaxed);
+        total.store(0, std::memory_order_relaxed);
+        sum.store(0, std::memory_order_relaxed);
+        max.store(0, std::memory_order_relaxed);
+    }
+
+    // ========================================================================
+    // READERS (any thread)
+    // ========================================================================
+
+    std::uint64_t getCount() const noexcept { return total.load(std::memory_order_relaxed); }
+    std::uint64_t getMax() const noexcept { return max.load(std::memory_order_relaxed); }
+
+    double getMean() const noexcept
+    {
+        const std::uint64_t n = getCount();
+        return n > 0 ? static_cast<double>(sum.load(std::memory_order_relaxed)) / static_cast<double>(n) : 0.0;
+    }
+
+    Counts snapshot() const noexcept
+    {
+        Counts out{};
+        for (size_t i = 0; i < out.size(); ++i)
+            out[i] = counts[i].load(std::memory_order_relaxed);
+        return out;
+    }
+
+    /**
+     * Value at or below which `fraction` of the samples lie (bucket upper
+     * bound, capped at the observed maximum; 0 when empty)
+     */
+    double percentile(double fraction) const noexcept
+    {
+        const Counts copy = snapshot();
+        std::uint64_t n = 0;
+        for (const std::uint64_t c : copy)
+            n += c;
+        if (n == 0)
+            return 0.0;
+
+        const double rank = fraction * static_cast<double>(n);
+        std::uint64_t cumulative = 0;
+        for (int i = 0; i < NUM_BUCKETS; ++i)
+        {
+            cumulative += copy[static_cast<size_t>(i)];
+            if (static_cast<double>(cumulative) >= rank && cumulative > 0)
+            {
+                const double upper = bucketUpperBound(i);
+                const double observed = static_cast<double>(getMax());
+                return upper < observed ? upper : observed;
+            }
+        }
+        return static_cast<double>(getMax());
+    }
+
+private:
+    static constexpr int highestBit(std::uint64_t value) noexcept
+    {
+        int bit = -1;
+        for (int step = 32; step > 0; step /= 2)
+        {
+            if (value >> step)
+            {
+                value >>= step;
+                bit += step;
+            }
+        }
+        return value ? bit + 1 : bit;
+    }
+
+    std::array<std::atomic<std::uint64_t>, NUM_BUCKETS> counts{};
+    std::atomic<std::uint64_t> total{0};
+    std::atomic<std::uint64_t> sum{0};
+    std::atomic<std::uint64_t> max{0};
+};
+
+/**
+ * Callback timing summary (durations in ns, utilisation as a fraction of
+ * the buffer length: 1.0 = the callback took as long as its audio lasts)
+ */
+struct CallbackTimingStats
+{
+    std::uint64_t callbacks{0};
+    std::uint64_t overruns{0};      // callbacks that took longer than their buffer
+    double meanNs{0.0};
+    double p50Ns{0.0};
+    double p99Ns{0.0};
+    double worstNs{0.0};
+    double meanUtilisation{0.0};
+    double p99Utilisation{0.0};
+    double worstUtilisation{0.0};
+};
+
+/**
+ * Callback Timer - per-callback duration and budget utilisation
+ *
+ * The audio thread wraps each callback in a Scope (two steady_clock reads,
+ * a vDSO call on Linux / QueryPerformanceCounter / mach_absolute_time) and
+ * records into two LogBucketHistograms: duration in ns and utilisation in
+ * ppm of the buffer length. Any thread can read getStats() at any time.
+ * prepare() / reset() must not run concurrently with the audio thread.
+ */
+class CallbackTimer
+{
+public:
+    /**
+     * Set the rate the budget is computed from and clear all statistics
+     */
+    void prepare(double sampleRate) noexcept
+    {
+        nsPerSample = sampleRate > 0.0 ? 1e9 / sampleRate : 0.0;
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        durations.reset();
+        utilisation.reset();
+        overruns.store(0, std::memory_order_relaxed);
+    }
+
+    static std::int64_t now() noexcept
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    /**
+     * Record one callback that covered numSamples frames (audio thread)
+     */
+    void record(std::int64_t durationNs, int numSamples) noexcept
+    {
+        const std::uint64_t ns = durationNs > 0 ? static_cast<std::uint64_t>(durationNs) : 0;
+        durations.add(ns);
+
+        const double budgetNs = numSamples * nsPerSample;
+        if (budgetNs > 0.0)
+        {
+            const double ppm = static_cast<double>(ns) / budgetNs * ProcessorSSOT::Timing::UTILISATION_PPM;
+            utilisation.add(static_cast<std::uint64_t>(ppm));
+            if (static_cast<double>(ns) > budgetNs)
+                overruns.store(overruns.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Times the enclosing scope (construct at the top of the callback)
+     */
+    class Scope
+    {
+    public:
+        Scope(CallbackTimer& timerToUse, int numSamplesInCallback) noexcept
+            : timer(timerToUse), numSamples(numSamplesInCallback), start(now()) {}
+
+        ~Scope() { timer.record(now() - start, numSamples); }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        CallbackTimer& timer;
+        int numSamples;
+        std::int64_t start;
+    };
+
+    CallbackTimingStats getStats() const noexcept
+    {
+        constexpr double ppm = ProcessorSSOT::Timing::UTILISATION_PPM;
+
+        CallbackTimingStats stats;
+        stats.callbacks = durations.getCount();
+        stats.overruns = overruns.load(std::memory_order_relaxed);
+        stats.meanNs = durations.getMean();
+        stats.p50Ns = durations.percentile(0.50);
+        stats.p99Ns = durations.percentile(0.99);
+        stats.worstNs = static_cast<double>(durations.getMax());
+        stats.meanUtilisation = utilisation.getMean() / ppm;
+        stats.p99Utilisation = utilisation.percentile(0.99) / ppm;
+        stats.worstUtilisation = static_cast<double>(utilisation.getMax()) / ppm;
+        return stats;
+    }
+
+    const LogBucketHistogram& getDurationHistogram() const noexcept { return durations; }
+    const LogBucketHistogram& getUtilisationHistogram() const noexcept { return utilisation; }
+
+private:
+    LogBucketHistogram durations;      // ns per callback
+    LogBucketHistogram utilisation;    // ppm of the buffer length
+    std::atomic<std::uint64_t> overruns{0};
+    double nsPerSample{0.0};
+};
+
+// ========================================================================
+// FORMATTING (diagnostics, tests)
+// ========================================================================
+
+/**
+ * One-line report of every field
+ */
+inline std::string formatTimingStats(const CallbackTimingStats& stats)
+{
+    char text[256];
+    std::snprintf(text, sizeof(text),
+                  "callbacks %llu | mean %.1f us, p50 %.1f us, p99 %.1f us, worst %.1f us"
+                  " | budget mean %.2f%%, p99 %.2f%%, worst %.2f%% | overruns %llu",
+                  static_cast<unsigned long long>(stats.callbacks),
+                  stats.meanNs * 1e-3, stats.p50Ns * 1e-3, stats.p99Ns * 1e-3, stats.worstNs * 1e-3,
+                  stats.meanUtilisation * 100.0, stats.p99Utilisation * 100.0, stats.worstUtilisation * 100.0,
+                  static_cast<unsigned long long>(stats.overruns));
+    return text;
+}
+
+/**
+ * Compact budget summary for the editor overlay
+ */
+inline std::string formatTimingSummary(const CallbackTimingStats& stats)
+{
+    char text[96];
+    std::snprintf(text, sizeof(text), "DSP %.2f%% | p99 %.2f%% | max %.2f%%",
+                  stats.meanUtilisation * 100.0, stats.p99Utilisation * 100.0, stats.worstUtilisation * 100.0);
+    return text;
+}
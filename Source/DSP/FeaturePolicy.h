@@ -0,0 +1,67 @@
+#pragma once
+
+#include <type_traits>
+
+/**
+ * Feature Policies - compile-time selection of the meters a core computes
+ *
+ * BasicBULLsEYEProcessorCore<Precision, FeatureSet> only runs the stages
+ * its feature set enables. A disabled stage is compiled out with
+ * if constexpr, and its state (filter bank, histograms, True Peak
+ * detector, history stream) and its published atomics are replaced by
+ * an empty Disabled member. Disabled meters read as their MeterFrame
+ * defaults.
+ *
+ * - INTEGRATED: gated integrated loudness and deviation
+ * - TRUE_PEAK: polyphase True Peak
+ * - MOMENTARY_SHORT_TERM: momentary / short-term loudness and their maxima
+ * - LOUDNESS_RANGE: EBU Tech 3342 LRA
+ * - STATS: per-hop history stream (momentary energy, sample peak,
+ *   True Peak window, gated flag) for the timeline
+ *
+ * K-weighting and the 100 ms sub-block ring run when any loudness stage
+ * is enabled.
+ */
+namespace Features
+{
+    /**
+     * Stand-in for the state of a disabled stage (accepts and ignores any initializer)
+     */
+    struct Disabled
+    {
+        constexpr Disabled() noexcept = default;
+
+        template<typename... Args>
+        constexpr explicit Disabled(Args&&...) noexcept {}
+    };
+
+    template<bool Enabled, typename T>
+    using Optional = std::conditional_t<Enabled, T, Disabled>;
+
+    template<bool Integrated, bool TruePeak, bool MomentaryShortTerm, bool LoudnessRange, bool Stats>
+    struct Set
+    {
+        static constexpr bool INTEGRATED = Integrated;
+        static constexpr bool TRUE_PEAK = TruePeak;
+        static constexpr bool MOMENTARY_SHORT_TERM = MomentaryShortTerm;
+        static constexpr bool LOUDNESS_RANGE = LoudnessRange;
+        static constexpr bool STATS = Stats;
+
+        static constexpr bool K_WEIGHTING = INTEGRATED || MOMENTARY_SHORT_TERM || LOUDNESS_RANGE;
+
+        static_assert(K_WEIGHTING || TRUE_PEAK, "A core must measure something");
+        static_assert(!STATS || INTEGRATED, "History records carry the gated flag of integrated loudness");
+    };
+
+    // Everything the plugin displays, including the timeline's history stream
+    using All = Set<true, true, true, true, true>;
+
+    // Every reported value, no history stream (offline analyzer)
+    using Analyzer = Set<true, true, true, true, false>;
+
+    // Integrated loudness only (QC of finished masters)
+    using IntegratedOnly = Set<true, false, false, false, false>;
+
+    // True Peak only
+    using TruePeakOnly = Set<false, true, false, false, false>;
+}
@@ -0,0 +1,245 @@
+#pragma once
+
+#include <cmath>
+#include <algorithm>
+#include "SIMDTypes.h"
+
+/**
+ * Multichannel halfband decimator cascade (SIMD)
+ *
+ * Brings high-rate audio down by 2, 4, 8 or 16 for the loudness path.
+ * Each 2:1 stage is a polyphase IIR halfband: two chains of first-order
+ * allpass sections at the output rate, one fed the later and one the
+ * earlier sample of each input pair, averaged
+ *   y = 0.5 * (A0(z) x[2k + 1] + A1(z) x[2k])
+ * Every section computes out = (x[n-1] + a * in) - a * y[n-1]
+ * (elliptic design: the phase is not linear, which loudness, an energy
+ * measure, does not see).
+ *
+ * - Wide stages (input >= 176.4 kHz): 3 sections, passband 0 - 20 kHz
+ *   flat within 1e-8 dB, images folding onto it attenuated >= 96 dB
+ * - Final stage (input 88.2 - 176.4 kHz): 6 sections, passband flat
+ *   within 1e-6 dB, stopband from 24.1 kHz (at 88.2 kHz in) >= 78 dB
+ *
+ * Channels are packed into the lanes of one vector of Sample and audio is
+ * passed as interleaved frames (frames[n * stride + channel], stride a
+ * multiple of LANES), as in KWeightingBank. Decimation is in place and
+ * streaming: any number of frames may be passed per call (including one),
+ * an incomplete input pair is held until the next call.
+ */
+template<int MaxChannels, typename Sample = double>
+class HalfbandDecimator
+{
+public:
+    using Vector = SIMD::VectorN<Sample>;
+    static constexpr int LANES = Vector::LANES;
+    static constexpr int MAX_STRIDE = SIMD::roundUpToLanes(MaxChannels, LANES);
+    static constexpr int MAX_STAGES = 4;        // 16:1
+    static constexpr int WIDE_SECTIONS = 3;
+    static constexpr int FINAL_SECTIONS = 6;
+
+    // Allpass coefficients; even indices run on the later sample of a pair, odd on the earlier
+    static constexpr double WIDE_COEFFS[WIDE_SECTIONS] = {
+        0.06637482650008955, 0.2742086047937559, 0.6751236108971478
+    };
+    static constexpr double FINAL_COEFFS[FINAL_SECTIONS] = {
+        0.06282492510444714, 0.22381639742037138, 0.42439855020719625,
+        0.6165594353837534, 0.7818857566237475, 0.9274844554444897
+    };
+
+    /**
+     * Set the decimation factor (power of two, 1 - 16; 1 passes frames through)
+     * Clears all state
+     */
+    void setFactor(int newFactor) noexcept
+    {
+        numStages = 0;
+        while (numStages < MAX_STAGES && (2 << numStages) <= newFactor)
+            ++numStages;
+        factor = 1 << numStages;
+        reset();
+    }
+
+    int getFactor() const noexcept { return factor; }
+
+    /**
+     * Clear all stage histories and restart at a frame that starts an output period
+     */
+    void reset() noexcept
+    {
+        for (auto& stage : wide)
+            clear(stage, MAX_STRIDE);
+        clear(last, MAX_STRIDE);
+        position = 0;
+    }
+
+    /**
+     * Decimate interleaved frames in place
+     * Returns the number of output frames now at the start of frames
+     * (exactly one per factor input frames over any run of calls)
+     */
+    int processFrames(Sample* frames, int stride, int numSamples) noexcept
+    {
+        int n = numSamples;
+        for (int s = 0; s < numStages - 1; ++s)
+            n = decimate(wide[s], WIDE_COEFFS, frames, stride, n, isPending(s));
+        if (numStages > 0)
+            n = decimate(last, FINAL_COEFFS, frames, stride, n, isPending(numStages - 1));
+
+        position = (position + numSamples) & (factor - 1);
+        return n;
+    }
+
+    /**
+     * Advance over silent input without processing it
+     * Only valid while every history is zero (see flushDecayed)
+     */
+    void skip(int numSamples) noexcept
+    {
+        position = (position + numSamples) & (factor - 1);
+    }
+
+    /**
+     * Zero the histories of the first numChannels channels if every value
+     * that still affects an output has decayed below threshold; returns
+     * true if they are now all zero (like KWeightingBank::flushDecayed)
+     */
+    bool flushDecayed(int numChannels, Sample threshold) noexcept
+    {
+        numChannels = std::min(numChannels, MAX_STRIDE);
+
+        for (int s = 0; s < numStages - 1; ++s)
+            if (!hasDecayed(wide[s], numChannels, threshold, isPending(s)))
+                return false;
+        if (numStages > 0 && !hasDecayed(last, numChannels, threshold, isPending(numStages - 1)))
+            return false;
+
+        for (auto& stage : wide)
+            clear(stage, numChannels);
+        clear(last, numChannels);
+        return true;
+    }
+
+private:
+    /**
+     * State of one 2:1 stage, interleaved like the frames: [section][channel]
+     */
+    template<int Sections>
+    struct Stage
+    {
+        alignas(SIMD::VECTOR_ALIGNMENT) Sample x[Sections][MAX_STRIDE]{};  // section inputs, previous output frame
+        alignas(SIMD::VECTOR_ALIGNMENT) Sample y[Sections][MAX_STRIDE]{};  // section outputs, previous output frame
+        alignas(SIMD::VECTOR_ALIGNMENT) Sample held[MAX_STRIDE]{};         // earlier sample of an incomplete pair
+    };
+
+    Stage<WIDE_SECTIONS> wide[MAX_STAGES - 1];
+    Stage<FINAL_SECTIONS> last;
+    int numStages{0};
+    int factor{1};
+    int position{0};  // input frames since the last output, mod factor
+
+    // Stage s has received an odd number of inputs (its held sample is live)
+    bool isPending(int s) const noexcept { return ((position >> s) & 1) != 0; }
+
+    template<int Sections>
+    static int decimate(Stage<Sections>& stage, const double (&coeffs)[Sections],
+                        Sample* frames, int stride, int numSamples, bool pending) noexcept
+    {
+        Vector a[Sections];
+        for (int k = 0; k < Sections; ++k)
+            a[k] = Vector::broadcast(static_cast<Sample>(coeffs[k]));
+
+        int numOut = 0;
+        for (int group = 0; group < stride; group += LANES)
+        {
+            Vector x[Sections], y[Sections];
+            for (int k = 0; k < Sections; ++k)
+            {
+                x[k] = Vector::load(stage.x[k] + group);
+                y[k] = Vector::load(stage.y[k] + group);
+            }
+
+            Sample* frame = frames + group;
+            int i = 0;
+            numOut = 0;
+
+            if (pending && numSamples > 0)
+            {
+                tick(a, x, y, Vector::load(stage.held + group), Vector::load(frame)).store(frame);
+                i = numOut = 1;
+            }
+
+            // Output k is written over input frame k or later: already read
+            for (; i + 1 < numSamples; i += 2, ++numOut)
+            {
+                const Vector earlier = Vector::load(frame + i * stride);
+                const Vector later = Vector::load(frame + (i + 1) * stride);
+                tick(a, x, y, earlier, later).store(frame + numOut * stride);
+            }
+
+            if (i < numSamples)
+                Vector::load(frame + i * stride).store(stage.held + group);
+
+            for (int k = 0; k < Sections; ++k)
+            {
+                x[k].store(stage.x[k] + group);
+                y[k].store(stage.y[k] + group);
+            }
+        }
+        return numOut;
+    }
+
+    template<int Sections>
+    static Vector tick(const Vector (&a)[Sections], Vector (&x)[Sections], Vector (&y)[Sections],
+                       Vector earlier, Vector later) noexcept
+    {
+        Vector path0 = later;
+        for (int k = 0; k < Sections; k += 2)
+            path0 = allpass(a[k], x[k], y[k], path0);
+
+        Vector path1 = earlier;
+        for (int k = 1; k < Sections; k += 2)
+            path1 = allpass(a[k], x[k], y[k], path1);
+
+        return (path0 + path1) * Vector::broadcast(Sample(0.5));
+    }
+
+    static Vector allpass(Vector a, Vector& x1, Vector& y1, Vector in) noexcept
+    {
+        // a * y1 is the only term on the recursive path (one multiply, one subtract)
+        const Vector out = (x1 + a * in) - a * y1;
+        x1 = in;
+        y1 = out;
+        return out;
+    }
+
+    template<int Sections>
+    static bool hasDecayed(const Stage<Sections>& stage, int numChannels, Sample threshold, bool pending) noexcept
+    {
+        for (int k = 0; k < Sections; ++k)
+            for (int ch = 0; ch < numChannels; ++ch)
+                if (!(std::abs(stage.x[k][ch]) < threshold && std::abs(stage.y[k][ch]) < threshold))
+                    return false;
+
+        // A held sample that is not pending is overwritten before use
+        if (pending)
+            for (int ch = 0; ch < numChannels; ++ch)
+                if (!(std::abs(stage.held[ch]) < threshold))
+                    return false;
+        return true;
+    }
+
+    template<int Sections>
+    static void clear(Stage<Sections>& stage, int numChannels) noexcept
+    {
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            for (int k = 0; k < Sections; ++k)
+            {
+                stage.x[k][ch] = Sample(0);
+                stage.y[k][ch] = Sample(0);
+            }
+            stage.held[ch] = Sample(0);
+        }
+    }
+};
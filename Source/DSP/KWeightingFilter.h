@@ -0,0 +1,163 @@
+#pragma once
+
+#include <cmath>
+#include "SIMDTypes.h"
+
+/**
+ * Multichannel K-weighting filter bank (SIMD)
+ *
+ * Runs the K-weighting chain (High-pass 60 Hz -> High-shelf 4 kHz) for
+ * up to MaxChannels channels. Channels are packed into the lanes of one
+ * vector of Sample (double: L/R share an SSE2/NEON pair, four channels
+ * with AVX; float: four channels per vector, eight with AVX), and every
+ * channel uses the same coefficients, rounded to Sample.
+ *
+ * Audio is passed as interleaved frames: frames[n * stride + channel],
+ * with stride a multiple of LANES. Padding lanes must be zero and stay zero.
+ *
+ * Operation order matches the scalar JSFX reference exactly:
+ *   y = b0*x + b1*x1 + b2*x2 - a1*y1 - a2*y2
+ * so results are bit-identical to per-channel scalar biquads.
+ */
+template<int MaxChannels, typename Sample = double>
+class KWeightingBank
+{
+public:
+    using Vector = SIMD::VectorN<Sample>;
+    static constexpr int LANES = Vector::LANES;
+    static constexpr int MAX_STRIDE = SIMD::roundUpToLanes(MaxChannels, LANES);
+
+    /**
+     * Set shared coefficients [b0, b1, b2, a1, a2] (normalized by a0)
+     */
+    void setCoefficients(const double* hp, const double* hs) noexcept
+    {
+        for (int i = 0; i < 5; ++i)
+        {
+            for (int lane = 0; lane < LANES; ++lane)
+            {
+                hpCoeffs[i][lane] = static_cast<Sample>(hp[i]);
+                hsCoeffs[i][lane] = static_cast<Sample>(hs[i]);
+            }
+        }
+    }
+
+    /**
+     * Clear filter histories for all channels
+     */
+    void reset() noexcept
+    {
+        for (int tap = 0; tap < 4; ++tap)
+        {
+            for (int ch = 0; ch < MAX_STRIDE; ++ch)
+            {
+                hpState[tap][ch] = Sample(0);
+                hsState[tap][ch] = Sample(0);
+            }
+        }
+    }
+
+    /**
+     * Zero the histories of the first numChannels channels if every value
+     * has decayed below threshold; returns true if they are now all zero
+     * (after silence the recursion never reaches zero by itself, it
+     * settles into denormal limit cycles)
+     */
+    bool flushDecayed(int numChannels, Sample threshold) noexcept
+    {
+        numChannels = std::min(numChannels, MAX_STRIDE);
+
+        for (int tap = 0; tap < 4; ++tap)
+            for (int ch = 0; ch < numChannels; ++ch)
+                if (!(std::abs(hpState[tap][ch]) < threshold && std::abs(hsState[tap][ch]) < threshold))
+                    return false;
+
+        for (int tap = 0; tap < 4; ++tap)
+        {
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                hpState[tap][ch] = Sample(0);
+                hsState[tap][ch] = Sample(0);
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Filter interleaved frames in place
+     * Each lane group keeps its state in registers for the whole block
+     */
+    void processFrames(Sample* frames, int stride, int numSamples) noexcept
+    {
+        for (int group = 0; group < stride; group += LANES)
+        {
+            State s = loadState(group);
+            Sample* x = frames + group;
+
+            for (int i = 0; i < numSamples; ++i, x += stride)
+                tick(s, Vector::load(x)).store(x);
+
+            storeState(s, group);
+        }
+    }
+
+private:
+    // Interleaved lane state: [tap][channel]
+    // HP/HS taps: [0]=x[n-1], [1]=x[n-2], [2]=y[n-1], [3]=y[n-2]
+    alignas(SIMD::VECTOR_ALIGNMENT) Sample hpState[4][MAX_STRIDE]{};
+    alignas(SIMD::VECTOR_ALIGNMENT) Sample hsState[4][MAX_STRIDE]{};
+    // Coefficients broadcast to every lane: [b0, b1, b2, a1, a2]
+    alignas(SIMD::VECTOR_ALIGNMENT) Sample hpCoeffs[5][LANES]{};
+    alignas(SIMD::VECTOR_ALIGNMENT) Sample hsCoeffs[5][LANES]{};
+
+    struct State
+    {
+        Vector hpX1, hpX2, hpY1, hpY2;
+        Vector hsX1, hsX2, hsY1, hsY2;
+    };
+
+    State loadState(int group) const noexcept
+    {
+        return {Vector::load(hpState[0] + group), Vector::load(hpState[1] + group),
+                Vector::load(hpState[2] + group), Vector::load(hpState[3] + group),
+                Vector::load(hsState[0] + group), Vector::load(hsState[1] + group),
+                Vector::load(hsState[2] + group), Vector::load(hsState[3] + group)};
+    }
+
+    void storeState(const State& s, int group) noexcept
+    {
+        s.hpX1.store(hpState[0] + group); s.hpX2.store(hpState[1] + group);
+        s.hpY1.store(hpState[2] + group); s.hpY2.store(hpState[3] + group);
+        s.hsX1.store(hsState[0] + group); s.hsX2.store(hsState[1] + group);
+        s.hsY1.store(hsState[2] + group); s.hsY2.store(hsState[3] + group);
+    }
+
+    Vector tick(State& s, Vector x) const noexcept
+    {
+        // HP biquad: y[n] = b0*x[n] + b1*x[n-1] + b2*x[n-2] - a1*y[n-1] - a2*y[n-2]
+        const Vector yHP = Vector::load(hpCoeffs[0]) * x
+                         + Vector::load(hpCoeffs[1]) * s.hpX1
+                         + Vector::load(hpCoeffs[2]) * s.hpX2
+                         - Vector::load(hpCoeffs[3]) * s.hpY1
+                         - Vector::load(hpCoeffs[4]) * s.hpY2;
+
+        s.hpX2 = s.hpX1;
+        s.hpX1 = x;
+        s.hpY2 = s.hpY1;
+        s.hpY1 = yHP;
+
+        // HS biquad: input is HP output, using HS's own input/output history
+        const Vector yHS = Vector::load(hsCoeffs[0]) * yHP
+                         + Vector::load(hsCoeffs[1]) * s.hsX1
+                         + Vector::load(hsCoeffs[2]) * s.hsX2
+                         - Vector::load(hsCoeffs[3]) * s.hsY1
+                         - Vector::load(hsCoeffs[4]) * s.hsY2;
+
+        s.hsX2 = s.hsX1;
+        s.hsX1 = yHP;
+        s.hsY2 = s.hsY1;
+        s.hsY1 = yHS;
+
+        return yHS;
+    }
+};
@@ -0,0 +1,249 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <algorithm>
+#include "../SSOT/DSPSSOT.h"
+
+/**
+ * Loudness Histogram - constant-memory block store for gated integration
+ *
+ * Stores gating blocks (mean-square K-weighted energy) in fixed 0.1 LU bins
+ * from the absolute gate (-70 LUFS) to +5 LUFS. Each bin keeps the block
+ * count and the exact energy sum of its blocks, so the gated mean is exact
+ * for every bin that passes the gate; only the bin holding the relative
+ * threshold is resolved at bin granularity (0.1 LU).
+ *
+ * Gating is recomputed from scratch in O(bins) whenever it is requested,
+ * so blocks admitted early are re-evaluated once the relative gate rises
+ * (true BS.1770 two-pass gating), with no per-block storage.
+ *
+ * The same histogram fed with short-term (3 s) values gives the EBU Tech 3342
+ * Loudness Range: percentiles are read from cumulative bin counts in O(bins).
+ *
+ * Real-time safe: no allocation, no locks, no transcendental functions
+ * (bin lookup is a binary search over precomputed energy edges).
+ */
+class LoudnessHistogram
+{
+public:
+    static constexpr int NUM_BINS = DSPSSOT::GatedIntegration::HISTOGRAM_NUM_BINS;
+
+    /**
+     * Gated result: mean energy and number of blocks above the gate
+     * gateEnergy is the relative gate in the energy domain at bin granularity:
+     * a block passes both gates (passesGates) iff its energy >= gateEnergy
+     */
+    struct Gated
+    {
+        double meanEnergy{0.0};
+        std::int64_t count{0};
+        double gateEnergy{std::numeric_limits<double>::infinity()};
+    };
+
+    LoudnessHistogram() noexcept
+    {
+        edges();  // Build the edge table off the audio thread
+        reset();
+    }
+
+    /**
+     * Clear all bins
+     */
+    void reset() noexcept
+    {
+        std::fill(binEnergy, binEnergy + NUM_BINS, 0.0);
+        std::fill(binCount, binCount + NUM_BINS, std::int64_t{0});
+        totalEnergy = 0.0;
+        totalCount = 0;
+    }
+
+    /**
+     * Add one block's mean-square energy
+     * Blocks below the absolute gate are discarded
+     * Returns true if the block passed the absolute gate
+     */
+    bool add(double energy) noexcept
+    {
+        if (!(energy >= edges().energy[0]))
+            return false;
+
+        const int bin = binIndex(energy);
+        binEnergy[bin] += energy;
+        binCount[bin]++;
+        totalEnergy += energy;
+        totalCount++;
+        return true;
+    }
+
+    /**
+     * Add every block of another histogram (e.g. a segment measured in parallel)
+     * Gating is applied afterwards over the combined blocks, so merging the
+     * segments of a program gives the same result as measuring it in one pass
+     */
+    void merge(const LoudnessHistogram& other) noexcept
+    {
+        for (int bin = 0; bin < NUM_BINS; ++bin)
+        {
+            binEnergy[bin] += other.binEnergy[bin];
+            binCount[bin] += other.binCount[bin];
+        }
+        totalEnergy += other.totalEnergy;
+        totalCount += other.totalCount;
+    }
+
+    /**
+     * Two-pass gated mean
+     * Pass 1: mean of all blocks above the absolute gate
+     * Pass 2: mean of blocks at or above (pass 1 mean * relativeGateFactor)
+     * relativeGateFactor is the gate in the energy domain, e.g. 0.1 for -10 LU
+     */
+    Gated gatedMean(double relativeGateFactor) const noexcept
+    {
+        Gated result;
+        if (totalCount == 0)
+            return result;
+
+        const double threshold = (totalEnergy / static_cast<double>(totalCount)) * relativeGateFactor;
+        const int startBin = (threshold >= edges().energy[0]) ? binIndex(threshold) : 0;
+        result.gateEnergy = edges().energy[startBin];
+
+        double energy = 0.0;
+        for (int bin = startBin; bin < NUM_BINS; ++bin)
+        {
+            energy += binEnergy[bin];
+            result.count += binCount[bin];
+        }
+
+        if (result.count > 0)
+            result.meanEnergy = energy / static_cast<double>(result.count);
+
+        return result;
+    }
+
+    /**
+     * True if a block of this energy is counted by gatedMean(relativeGateFactor)
+     * (absolute gate, then the current relative gate at bin granularity)
+     */
+    bool passesGates(double energy, double relativeGateFactor) const noexcept
+    {
+        if (totalCount == 0 || !(energy >= edges().energy[0]))
+            return false;
+
+        const double threshold = (totalEnergy / static_cast<double>(totalCount)) * relativeGateFactor;
+        const int startBin = (threshold >= edges().energy[0]) ? binIndex(threshold) : 0;
+        return binIndex(energy) >= startBin;
+    }
+
+    /**
+     * Loudness spread between two percentiles of the gated distribution (LU)
+     * Gating matches gatedMean(); each percentile is interpolated linearly
+     * inside its 0.1 LU bin. Returns 0 when no block passes the gates.
+     * e.g. EBU Tech 3342 LRA: percentileRange(0.01, 0.10, 0.95)
+     */
+    double percentileRange(double relativeGateFactor, double lowPercentile, double highPercentile) const noexcept
+    {
+        if (totalCount == 0)
+            return 0.0;
+
+        const double threshold = (totalEnergy / static_cast<double>(totalCount)) * relativeGateFactor;
+        const int startBin = (threshold >= edges().energy[0]) ? binIndex(threshold) : 0;
+
+        std::int64_t count = 0;
+        for (int bin = startBin; bin < NUM_BINS; ++bin)
+            count += binCount[bin];
+
+        if (count == 0)
+            return 0.0;
+
+        return percentileLUFS(startBin, count, highPercentile) - percentileLUFS(startBin, count, lowPercentile);
+    }
+
+    /**
+     * Number of blocks above the absolute gate
+     */
+    std::int64_t getCount() const noexcept { return totalCount; }
+
+    /**
+     * Energy at the lower edge of a bin (for percentile / display mapping)
+     */
+    static double binLowerEnergy(int bin) noexcept { return edges().energy[bin]; }
+
+    /**
+     * Loudness at the lower edge of a bin (LUFS, uncalibrated)
+     */
+    static constexpr double binLowerLUFS(int bin) noexcept
+    {
+        return DSPSSOT::GatedIntegration::HISTOGRAM_MIN_LUFS
+             + bin * DSPSSOT::GatedIntegration::HISTOGRAM_BIN_WIDTH_LU;
+    }
+
+    /**
+     * Blocks stored in one bin
+     */
+    std::int64_t getBinCount(int bin) const noexcept { return binCount[bin]; }
+
+private:
+    double binEnergy[NUM_BINS];
+    std::int64_t binCount[NUM_BINS];
+    double totalEnergy{0.0};
+    std::int64_t totalCount{0};
+
+    /**
+     * Bin edges in the energy domain: L = K_OFFSET + 10*log10(e)
+     * Computed once on first use; the constructor forces this off the audio thread
+     */
+    struct Edges
+    {
+        double energy[NUM_BINS + 1];
+
+        Edges() noexcept
+        {
+            for (int bin = 0; bin <= NUM_BINS; ++bin)
+                energy[bin] = std::pow(10.0, (binLowerLUFS(bin) - DSPSSOT::GatedIntegration::K_OFFSET_DB) / 10.0);
+        }
+    };
+
+    static const Edges& edges() noexcept
+    {
+        static const Edges table;
+        return table;
+    }
+
+    /**
+     * Loudness at a percentile (0-1) of the blocks stored from startBin upwards
+     */
+    double percentileLUFS(int startBin, std::int64_t count, double percentile) const noexcept
+    {
+        const double rank = percentile * static_cast<double>(count);
+        std::int64_t below = 0;
+
+        for (int bin = startBin; bin < NUM_BINS; ++bin)
+        {
+            if (binCount[bin] == 0)
+                continue;
+
+            if (static_cast<double>(below + binCount[bin]) >= rank)
+            {
+                const double fraction = (rank - static_cast<double>(below)) / static_cast<double>(binCount[bin]);
+                return binLowerLUFS(bin) + std::max(fraction, 0.0) * DSPSSOT::GatedIntegration::HISTOGRAM_BIN_WIDTH_LU;
+            }
+
+            below += binCount[bin];
+        }
+
+        return binLowerLUFS(NUM_BINS);
+    }
+
+    /**
+     * Bin holding an energy at or above the lowest edge (clamped to the top bin)
+     */
+    static int binIndex(double energy) noexcept
+    {
+        const double* first = edges().energy;
+        const double* last = first + NUM_BINS + 1;
+        const int bin = static_cast<int>(std::upper_bound(first, last, energy) - first) - 1;
+        return std::min(std::max(bin, 0), NUM_BINS - 1);
+    }
+};
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+#include "SPSCRing.h"
+#include "../SSOT/ProcessorSSOT.h"
+
+/**
+ * Loudness Hop Record - one entry per 100 ms gating hop
+ *
+ * Raw linear values so the audio thread does no log conversions:
+ * - momentaryEnergy: mean-square K-weighted energy of the 400 ms window
+ *   ending at this hop (ungated, channel-weighted)
+ * - samplePeak / truePeak: largest |x| over all channels within the hop
+ *   (true peak includes the interpolated phases; FIR delay ~6 samples).
+ *   Where the True Peak early out skipped interpolation (material below
+ *   the running peak), truePeak is an upper estimate: at least the exact
+ *   hop value, at most the running True Peak
+ * - gated: the 400 ms block passed the absolute and current relative gate
+ * - samplePosition: samples processed at the end of the hop (restarts
+ *   from 0 when the measurement is reset)
+ */
+struct LoudnessHopRecord
+{
+    std::int64_t samplePosition{0};
+    double momentaryEnergy{0.0};
+    float samplePeak{0.0f};
+    float truePeak{0.0f};
+    bool gated{false};
+};
+
+/**
+ * Audio thread -> reader stream of hop records (see SPSCRing)
+ */
+using LoudnessHistoryRing = SPSCRing<LoudnessHopRecord>;
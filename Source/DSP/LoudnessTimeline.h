@@ -0,0 +1,204 @@
+#pragma once
+
+#include <cmath>
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include "LoudnessHistory.h"
+#include "../SSOT/DSPSSOT.h"
+
+/**
+ * Loudness Timeline - mipmapped min/max/mean history of 100 ms frames
+ *
+ * Level k of the pyramid aggregates 2^k consecutive frames per bucket
+ * (momentary loudness min / max, mean energy, True Peak max). Every level
+ * is a fixed ring of the newest BUCKETS_PER_LEVEL buckets, so memory is
+ * bounded: recent history is kept at full resolution, older history only
+ * at coarser levels (level-of-detail downsampling).
+ *
+ * render() picks the finest level whose buckets are no wider than one
+ * column and still cover the requested span, so each column reads one or
+ * two buckets: cost is O(columns) for any zoom and any session length.
+ *
+ * Message thread only (fed from the audio thread's LoudnessHistoryRing).
+ * JUCE-free so it can be unit tested.
+ */
+class LoudnessTimeline
+{
+public:
+    static constexpr int NUM_LEVELS = DSPSSOT::Timeline::NUM_LEVELS;
+    static constexpr int BUCKETS_PER_LEVEL = DSPSSOT::Timeline::BUCKETS_PER_LEVEL;
+
+    /**
+     * One rendered column (loudness in LUFS, True Peak in dBTP)
+     */
+    struct Column
+    {
+        float minLUFS{0.0f};
+        float maxLUFS{0.0f};
+        float meanLUFS{0.0f};
+        float truePeakDB{0.0f};
+        bool valid{false};  // false where the span has no (retained) data
+    };
+
+    LoudnessTimeline()
+        : buckets(static_cast<size_t>(NUM_LEVELS) * BUCKETS_PER_LEVEL)
+    {
+        clear();
+    }
+
+    /**
+     * Drop all history
+     */
+    void clear() noexcept
+    {
+        for (Bucket& b : buckets)
+            b = Bucket{};
+        numFrames = 0;
+    }
+
+    /**
+     * Append one 100 ms frame (O(levels))
+     */
+    void addFrame(const LoudnessHopRecord& record) noexcept
+    {
+        const float lufs = static_cast<float>(DSPSSOT::Helpers::energyToDisplayLUFS(record.momentaryEnergy));
+        const float peak = static_cast<float>(std::max(static_cast<double>(record.truePeak), 0.0));
+        const double energy = std::isfinite(record.momentaryEnergy) ? std::max(record.momentaryEnergy, 0.0) : 0.0;
+
+        for (int level = 0; level < NUM_LEVELS; ++level)
+        {
+            const std::int64_t index = numFrames >> level;
+            Bucket& b = bucket(level, index);
+            if (b.index != index)
+            {
+                b = Bucket{};
+                b.index = index;
+                b.minLUFS = lufs;
+                b.maxLUFS = lufs;
+            }
+            b.minLUFS = std::min(b.minLUFS, lufs);
+            b.maxLUFS = std::max(b.maxLUFS, lufs);
+            b.energySum += energy;
+            b.truePeak = std::max(b.truePeak, peak);
+            b.count++;
+        }
+
+        numFrames++;
+    }
+
+    /**
+     * Frames added since construction / clear()
+     */
+    std::int64_t getNumFrames() const noexcept { return numFrames; }
+
+    /**
+     * Render the most recent spanFrames frames into numColumns columns
+     * (oldest on the left, newest frame in the last column)
+     */
+    void render(std::int64_t spanFrames, Column* columns, int numColumns) const noexcept
+    {
+        if (columns == nullptr || numColumns <= 0)
+            return;
+
+        spanFrames = std::max<std::int64_t>(spanFrames, 1);
+        const std::int64_t end = numFrames;             // exclusive
+        const std::int64_t start = end - spanFrames;
+        const int level = levelFor(spanFrames, numColumns, start);
+
+        for (int c = 0; c < numColumns; ++c)
+        {
+            // Frame range of this column: [first, last)
+            const std::int64_t first = start + (spanFrames * c) / numColumns;
+            std::int64_t last = start + (spanFrames * (c + 1)) / numColumns;
+            last = std::max(last, first + 1);
+
+            columns[c] = aggregate(level, std::max<std::int64_t>(first, 0), last);
+        }
+    }
+
+    /**
+     * Finest level usable for a view (exposed for tests)
+     */
+    int levelFor(std::int64_t spanFrames, int numColumns, std::int64_t firstFrame) const noexcept
+    {
+        int level = 0;
+
+        // Buckets no wider than one column
+        while (level + 1 < NUM_LEVELS && (std::int64_t{1} << (level + 1)) * numColumns <= spanFrames)
+            ++level;
+
+        // ... and still retained for the oldest visible frame
+        while (level + 1 < NUM_LEVELS && !isRetained(level, std::max<std::int64_t>(firstFrame, 0)))
+            ++level;
+
+        return level;
+    }
+
+private:
+    struct Bucket
+    {
+        std::int64_t index{-1};   // bucket number at its level (-1 = empty)
+        double energySum{0.0};
+        float minLUFS{0.0f};
+        float maxLUFS{0.0f};
+        float truePeak{0.0f};
+        std::uint32_t count{0};
+    };
+
+    std::vector<Bucket> buckets;  // NUM_LEVELS rings of BUCKETS_PER_LEVEL
+    std::int64_t numFrames{0};
+
+    Bucket& bucket(int level, std::int64_t index) noexcept
+    {
+        return buckets[static_cast<size_t>(level) * BUCKETS_PER_LEVEL + static_cast<size_t>(index % BUCKETS_PER_LEVEL)];
+    }
+
+    const Bucket& bucket(int level, std::int64_t index) const noexcept
+    {
+        return buckets[static_cast<size_t>(level) * BUCKETS_PER_LEVEL + static_cast<size_t>(index % BUCKETS_PER_LEVEL)];
+    }
+
+    bool isRetained(int level, std::int64_t frame) const noexcept
+    {
+        const std::int64_t index = frame >> level;
+        return bucket(level, index).index == index;
+    }
+
+    Column aggregate(int level, std::int64_t first, std::int64_t last) const noexcept
+    {
+        Column column;
+        if (last <= first)
+            return column;
+
+        double energySum = 0.0;
+        std::uint64_t count = 0;
+        float peak = 0.0f;
+
+        for (std::int64_t index = first >> level; index <= (last - 1) >> level; ++index)
+        {
+            const Bucket& b = bucket(level, index);
+            if (b.index != index || b.count == 0)
+                continue;
+
+            if (count == 0)
+            {
+                column.minLUFS = b.minLUFS;
+                column.maxLUFS = b.maxLUFS;
+            }
+            column.minLUFS = std::min(column.minLUFS, b.minLUFS);
+            column.maxLUFS = std::max(column.maxLUFS, b.maxLUFS);
+            energySum += b.energySum;
+            count += b.count;
+            peak = std::max(peak, b.truePeak);
+        }
+
+        if (count == 0)
+            return column;
+
+        column.valid = true;
+        column.meanLUFS = static_cast<float>(DSPSSOT::Helpers::energyToDisplayLUFS(energySum / static_cast<double>(count)));
+        column.truePeakDB = static_cast<float>(DSPSSOT::Helpers::linearToDb(peak));
+        return column;
+    }
+};
@@ -0,0 +1,232 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "../SSOT/ModelSSOT.h"
+#include "../SSOT/DSPSSOT.h"
+#include "../SSOT/ProcessorSSOT.h"
+#include "FeaturePolicy.h"
+
+/**
+ * Meter Frame - one consistent set of meter readings
+ *
+ * Every value comes from the same point in the audio stream: deviation
+ * belongs to the integrated loudness it was computed from, and the
+ * content type is the one that deviation was measured against.
+ * samplePosition is the number of samples the core had processed when
+ * the frame was published (a timestamp for UI / history consumers).
+ */
+struct MeterFrame
+{
+    double integratedLUFS{DSPSSOT::TruePeak::MIN_DISPLAY_DB};
+    double truePeakDB{DSPSSOT::TruePeak::MIN_DISPLAY_DB};
+    double deviationLU{0.0};
+    double momentaryLUFS{DSPSSOT::TruePeak::MIN_DISPLAY_DB};
+    double shortTermLUFS{DSPSSOT::TruePeak::MIN_DISPLAY_DB};
+    double maxMomentaryLUFS{DSPSSOT::TruePeak::MIN_DISPLAY_DB};
+    double maxShortTermLUFS{DSPSSOT::TruePeak::MIN_DISPLAY_DB};
+    double loudnessRangeLU{0.0};
+    // 64-bit: multi-hour programs at high sample rates overflow int
+    std::int64_t sampleSum{0};
+    // Fixes Law 2.5: all processed samples (not just gated) for reliable transport detection
+    std::int64_t totalSamplesProcessed{0};
+    std::int64_t samplePosition{0};
+    ModelSSOT::ContentType contentType{ModelSSOT::ContentType::MusicDrums};
+};
+
+/**
+ * Meter Levels - the audio thread's side of a MeterFrame
+ *
+ * Loudness is kept as mean-square K-weighted energy and True Peak as a
+ * linear peak, so the audio thread never calls log10: maxima are taken
+ * in the energy domain (the dB mapping is monotonic) and deviation is
+ * derived from the integrated value. toFrame() converts to display units
+ * on the reading thread, giving exactly the values a dB-domain core would.
+ */
+struct MeterLevels
+{
+    double integratedEnergy{0.0};      // gated mean energy, 0 while no block passes the gates
+    double truePeak{0.0};              // linear
+    double momentaryEnergy{0.0};
+    double shortTermEnergy{0.0};
+    double maxMomentaryEnergy{0.0};
+    double maxShortTermEnergy{0.0};
+    double loudnessRangeLU{0.0};       // histogram percentiles, already in LU
+    std::int64_t sampleSum{0};
+    std::int64_t totalSamplesProcessed{0};
+    std::int64_t samplePosition{0};
+    ModelSSOT::ContentType contentType{ModelSSOT::ContentType::MusicDrums};
+
+    /**
+     * Display values (LUFS / dBTP clamped to the display range)
+     */
+    MeterFrame toFrame() const noexcept
+    {
+        MeterFrame frame;
+        frame.integratedLUFS = DSPSSOT::Helpers::energyToDisplayLUFS(integratedEnergy);
+        frame.truePeakDB = DSPSSOT::Helpers::truePeakToDisplayDB(truePeak);
+        frame.momentaryLUFS = DSPSSOT::Helpers::energyToDisplayLUFS(momentaryEnergy);
+        frame.shortTermLUFS = DSPSSOT::Helpers::energyToDisplayLUFS(shortTermEnergy);
+        frame.maxMomentaryLUFS = DSPSSOT::Helpers::energyToDisplayLUFS(maxMomentaryEnergy);
+        frame.maxShortTermLUFS = DSPSSOT::Helpers::energyToDisplayLUFS(maxShortTermEnergy);
+        frame.loudnessRangeLU = loudnessRangeLU;
+        frame.sampleSum = sampleSum;
+        frame.totalSamplesProcessed = totalSamplesProcessed;
+        frame.samplePosition = samplePosition;
+        frame.contentType = contentType;
+
+        // Deviation from the content-type target, clamped to ±50 LU
+        if (sampleSum > 0)
+        {
+            constexpr double MAX_DEVIATION = 50.0;
+            const double dev = frame.integratedLUFS - ModelSSOT::Helpers::getTargetLUFS(contentType);
+            frame.deviationLU = std::min(std::max(dev, -MAX_DEVIATION), MAX_DEVIATION);
+        }
+        return frame;
+    }
+};
+
+/**
+ * Meter Frame Seqlock - single-writer publication of MeterFrame
+ *
+ * The writer publishes linear MeterLevels; read() converts the copied
+ * levels to a MeterFrame, so dB conversion runs on the reading thread.
+ *
+ * Writer (audio thread): wait-free, a fixed number of relaxed stores
+ * bracketed by two sequence increments; never blocks or allocates.
+ * Readers (any thread): copy the fields and retry if the sequence was
+ * odd (write in progress) or changed during the copy, so a returned
+ * frame is never torn across two publications.
+ *
+ * Fields are individual atomics (no data race on the payload) and must be
+ * lock-free, otherwise the writer could block on a library lock.
+ * Atomics of meters outside FeatureSet are compiled out and read back as
+ * their MeterFrame defaults.
+ * The object occupies whole cache lines so UI reads never share a line
+ * with audio-thread state.
+ */
+template<typename FeatureSet>
+class alignas(ProcessorSSOT::Performance::CACHE_LINE_PADDING) BasicMeterFrameSeqlock
+{
+public:
+    static_assert(std::atomic<double>::is_always_lock_free, "MeterFrame doubles must be lock-free atomics");
+    static_assert(std::atomic<std::int64_t>::is_always_lock_free, "MeterFrame counters must be lock-free atomics");
+    static_assert(std::atomic<std::uint32_t>::is_always_lock_free, "Seqlock sequence must be a lock-free atomic");
+
+    /**
+     * Publish a frame (single writer only)
+     */
+    void write(const MeterLevels& levels) noexcept
+    {
+        constexpr auto relaxed = std::memory_order_relaxed;
+
+        const std::uint32_t seq = sequence.load(relaxed);
+        sequence.store(seq + 1, relaxed);   // odd: write in progress
+        std::atomic_thread_fence(std::memory_order_release);
+
+        if constexpr (FeatureSet::INTEGRATED)
+        {
+            integratedEnergy.store(levels.integratedEnergy, relaxed);
+            sampleSum.store(levels.sampleSum, relaxed);
+        }
+        if constexpr (FeatureSet::TRUE_PEAK)
+            truePeak.store(levels.truePeak, relaxed);
+        if constexpr (FeatureSet::MOMENTARY_SHORT_TERM)
+        {
+            momentaryEnergy.store(levels.momentaryEnergy, relaxed);
+            shortTermEnergy.store(levels.shortTermEnergy, relaxed);
+            maxMomentaryEnergy.store(levels.maxMomentaryEnergy, relaxed);
+            maxShortTermEnergy.store(levels.maxShortTermEnergy, relaxed);
+        }
+        if constexpr (FeatureSet::LOUDNESS_RANGE)
+            loudnessRangeLU.store(levels.loudnessRangeLU, relaxed);
+        totalSamplesProcessed.store(levels.totalSamplesProcessed, relaxed);
+        samplePosition.store(levels.samplePosition, relaxed);
+        contentType.store(static_cast<std::int64_t>(levels.contentType), relaxed);
+
+        sequence.store(seq + 2, std::memory_order_release);   // even: frame complete
+    }
+
+    /**
+     * Read a consistent frame (retries while a write overlaps the copy,
+     * converts to display units once the copy is consistent)
+     */
+    MeterFrame read() const noexcept
+    {
+        return readLevels().toFrame();
+    }
+
+    /**
+     * Read consistent linear levels (retries while a write overlaps the copy)
+     */
+    MeterLevels readLevels() const noexcept
+    {
+        constexpr auto relaxed = std::memory_order_relaxed;
+        MeterLevels levels;
+        std::uint32_t before, after;
+
+        do
+        {
+            before = sequence.load(std::memory_order_acquire);
+
+            if constexpr (FeatureSet::INTEGRATED)
+            {
+                levels.integratedEnergy = integratedEnergy.load(relaxed);
+                levels.sampleSum = sampleSum.load(relaxed);
+            }
+            if constexpr (FeatureSet::TRUE_PEAK)
+                levels.truePeak = truePeak.load(relaxed);
+            if constexpr (FeatureSet::MOMENTARY_SHORT_TERM)
+            {
+                levels.momentaryEnergy = momentaryEnergy.load(relaxed);
+                levels.shortTermEnergy = shortTermEnergy.load(relaxed);
+                levels.maxMomentaryEnergy = maxMomentaryEnergy.load(relaxed);
+                levels.maxShortTermEnergy = maxShortTermEnergy.load(relaxed);
+            }
+            if constexpr (FeatureSet::LOUDNESS_RANGE)
+                levels.loudnessRangeLU = loudnessRangeLU.load(relaxed);
+            levels.totalSamplesProcessed = totalSamplesProcessed.load(relaxed);
+            levels.samplePosition = samplePosition.load(relaxed);
+            levels.contentType = static_cast<ModelSSOT::ContentType>(contentType.load(relaxed));
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = sequence.load(relaxed);
+        }
+        while ((before & 1u) != 0 || before != after);
+
+        return levels;
+    }
+
+    /**
+     * Number of completed publications (even sequence / 2)
+     */
+    std::uint32_t getPublishCount() const noexcept
+    {
+        return sequence.load(std::memory_order_acquire) / 2;
+    }
+
+private:
+    template<bool Enabled, typename T>
+    using Optional = Features::Optional<Enabled, std::atomic<T>>;
+
+    std::atomic<std::uint32_t> sequence{0};
+    Optional<FeatureSet::INTEGRATED, double> integratedEnergy{0.0};
+    Optional<FeatureSet::TRUE_PEAK, double> truePeak{0.0};
+    Optional<FeatureSet::MOMENTARY_SHORT_TERM, double> momentaryEnergy{0.0};
+    Optional<FeatureSet::MOMENTARY_SHORT_TERM, double> shortTermEnergy{0.0};
+    Optional<FeatureSet::MOMENTARY_SHORT_TERM, double> maxMomentaryEnergy{0.0};
+    Optional<FeatureSet::MOMENTARY_SHORT_TERM, double> maxShortTermEnergy{0.0};
+    Optional<FeatureSet::LOUDNESS_RANGE, double> loudnessRangeLU{0.0};
+    Optional<FeatureSet::INTEGRATED, std::int64_t> sampleSum{0};
+    std::atomic<std::int64_t> totalSamplesProcessed{0};
+    std::atomic<std::int64_t> samplePosition{0};
+    std::atomic<std::int64_t> contentType{static_cast<std::int64_t>(ModelSSOT::ContentType::MusicDrums)};
+};
+
+// Every meter published (the plugin)
+using MeterFrameSeqlock = BasicMeterFrameSeqlock<Features::All>;
+
+static_assert(sizeof(MeterFrameSeqlock) % ProcessorSSOT::Performance::CACHE_LINE_PADDING == 0,
+              "Published meters must fill whole cache lines");
@@ -0,0 +1,50 @@
+#pragma once
+
+/**
+ * Precision Policies - compile-time numeric types of the DSP core
+ *
+ * BasicBULLsEYEProcessorCore<Policy> runs its K-weighting filter bank in
+ * Policy::Filter and its energy sums (per-sample frame energy, 100 ms
+ * sub-block accumulator, momentary / short-term window sums) in
+ * Policy::Accumulator. Everything downstream of a finished sub-block stays
+ * double in every policy: gating histograms, published meter values and
+ * True Peak (an absolute sample measurement with no recursion to amortise).
+ *
+ * - Double:      reference, double throughout (the plugin)
+ * - FloatFilter: float biquads (twice the channels per SIMD vector), double
+ *                sums; stays well inside 0.05 LU of Double (offline tools)
+ * - Float:       float filters and sums; least accurate
+ *
+ * Input sanitizing, filtering and frame energy stay in Policy::Filter, so a
+ * float policy never widens a sample it has not yet filtered. Only the
+ * filter and energy stages get cheaper: with the full feature set, True
+ * Peak dominates and the float policies run no faster than Double, while
+ * LUFS-only cores with many channels (where float fills twice the lanes)
+ * are where they pay off.
+ *
+ * Accuracy against Double is measured by TestPrecisionPolicy, speed by
+ * BM_ProcessBlockPrecision (full and LUFS-I-only feature sets).
+ */
+namespace Precision
+{
+    struct Double
+    {
+        using Filter = double;
+        using Accumulator = double;
+        static constexpr const char* NAME = "double";
+    };
+
+    struct FloatFilter
+    {
+        using Filter = float;
+        using Accumulator = double;
+        static constexpr const char* NAME = "float filter / double accumulator";
+    };
+
+    struct Float
+    {
+        using Filter = float;
+        using Accumulator = float;
+        static constexpr const char* NAME = "float";
+    };
+}
@@ -0,0 +1,302 @@
+#pragma once
+
+#include <cmath>
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define BULLSEYE_SIMD_SSE2 1
+    #if defined(__AVX__)
+        #include <immintrin.h>
+        #define BULLSEYE_SIMD_AVX 1
+    #endif
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #include <arm_neon.h>
+    #define BULLSEYE_SIMD_NEON 1
+#endif
+
+/**
+ * BULLsEYE SIMD Types
+ *
+ * Minimal 2-lane (and, with AVX, 4-lane) double vectors used by the DSP kernels,
+ * and 4-lane (8-lane with AVX) float vectors for reduced-precision filter policies.
+ * Only plain multiply/add/sub are exposed (no fused multiply-add), so a
+ * vector kernel written in the same operation order as its scalar
+ * counterpart produces bit-identical results on every backend.
+ * Double2 also has abs/max for peak detection (exact on every backend).
+ *
+ * Backends: SSE2 (x86-64 baseline), AVX (-DBULLSEYE_ENABLE_AVX=ON, which
+ * compiles with -mavx but never -mfma, so no multiply-add is contracted),
+ * NEON (AArch64), scalar fallback.
+ *
+ * DoubleN / FloatN are the widest vectors available; channel-parallel
+ * kernels use VectorN<T> to pick the one for their sample type.
+ * leadingRunBelow() scans host buffers for silence. AlignedVector holds
+ * heap frames for the frame kernels (malloc only guarantees SSE2 alignment).
+ */
+namespace SIMD
+{
+    struct Double2
+    {
+        static constexpr int LANES = 2;
+
+#if BULLSEYE_SIMD_SSE2
+        __m128d v;
+
+        static Double2 load(const double* p) noexcept { return {_mm_load_pd(p)}; }
+        static Double2 set(double lane0, double lane1) noexcept { return {_mm_set_pd(lane1, lane0)}; }
+        static Double2 broadcast(double x) noexcept { return {_mm_set1_pd(x)}; }
+        void store(double* p) const noexcept { _mm_store_pd(p, v); }
+        double lane0() const noexcept { return _mm_cvtsd_f64(v); }
+        double lane1() const noexcept { return _mm_cvtsd_f64(_mm_unpackhi_pd(v, v)); }
+
+        friend Double2 operator*(Double2 a, Double2 b) noexcept { return {_mm_mul_pd(a.v, b.v)}; }
+        friend Double2 operator+(Double2 a, Double2 b) noexcept { return {_mm_add_pd(a.v, b.v)}; }
+        friend Double2 operator-(Double2 a, Double2 b) noexcept { return {_mm_sub_pd(a.v, b.v)}; }
+
+        friend Double2 abs(Double2 a) noexcept { return {_mm_andnot_pd(_mm_set1_pd(-0.0), a.v)}; }
+        friend Double2 max(Double2 a, Double2 b) noexcept { return {_mm_max_pd(a.v, b.v)}; }
+#elif BULLSEYE_SIMD_NEON
+        float64x2_t v;
+
+        static Double2 load(const double* p) noexcept { return {vld1q_f64(p)}; }
+        static Double2 set(double lane0, double lane1) noexcept
+        {
+            return {vsetq_lane_f64(lane1, vdupq_n_f64(lane0), 1)};
+        }
+        static Double2 broadcast(double x) noexcept { return {vdupq_n_f64(x)}; }
+        void store(double* p) const noexcept { vst1q_f64(p, v); }
+        double lane0() const noexcept { return vgetq_lane_f64(v, 0); }
+        double lane1() const noexcept { return vgetq_lane_f64(v, 1); }
+
+        // vmulq + vaddq (never vfmaq) to stay bit-identical with scalar code
+        friend Double2 operator*(Double2 a, Double2 b) noexcept { return {vmulq_f64(a.v, b.v)}; }
+        friend Double2 operator+(Double2 a, Double2 b) noexcept { return {vaddq_f64(a.v, b.v)}; }
+        friend Double2 operator-(Double2 a, Double2 b) noexcept { return {vsubq_f64(a.v, b.v)}; }
+
+        friend Double2 abs(Double2 a) noexcept { return {vabsq_f64(a.v)}; }
+        friend Double2 max(Double2 a, Double2 b) noexcept { return {vmaxq_f64(a.v, b.v)}; }
+#else
+        double v[2];
+
+        static Double2 load(const double* p) noexcept { return {{p[0], p[1]}}; }
+        static Double2 set(double lane0, double lane1) noexcept { return {{lane0, lane1}}; }
+        static Double2 broadcast(double x) noexcept { return {{x, x}}; }
+        void store(double* p) const noexcept { p[0] = v[0]; p[1] = v[1]; }
+        double lane0() const noexcept { return v[0]; }
+        double lane1() const noexcept { return v[1]; }
+
+        friend Double2 operator*(Double2 a, Double2 b) noexcept { return {{a.v[0] * b.v[0], a.v[1] * b.v[1]}}; }
+        friend Double2 operator+(Double2 a, Double2 b) noexcept { return {{a.v[0] + b.v[0], a.v[1] + b.v[1]}}; }
+        friend Double2 operator-(Double2 a, Double2 b) noexcept { return {{a.v[0] - b.v[0], a.v[1] - b.v[1]}}; }
+
+        friend Double2 abs(Double2 a) noexcept { return {{std::abs(a.v[0]), std::abs(a.v[1])}}; }
+        friend Double2 max(Double2 a, Double2 b) noexcept { return {{std::max(a.v[0], b.v[0]), std::max(a.v[1], b.v[1])}}; }
+#endif
+
+        // Largest lane
+        double maxLane() const noexcept { return std::max(lane0(), lane1()); }
+    };
+
+#if BULLSEYE_SIMD_AVX
+    struct Double4
+    {
+        static constexpr int LANES = 4;
+
+        __m256d v;
+
+        static Double4 load(const double* p) noexcept { return {_mm256_load_pd(p)}; }
+        static Double4 broadcast(double x) noexcept { return {_mm256_set1_pd(x)}; }
+        void store(double* p) const noexcept { _mm256_store_pd(p, v); }
+
+        friend Double4 operator*(Double4 a, Double4 b) noexcept { return {_mm256_mul_pd(a.v, b.v)}; }
+        friend Double4 operator+(Double4 a, Double4 b) noexcept { return {_mm256_add_pd(a.v, b.v)}; }
+        friend Double4 operator-(Double4 a, Double4 b) noexcept { return {_mm256_sub_pd(a.v, b.v)}; }
+    };
+
+    using DoubleN = Double4;
+#else
+    using DoubleN = Double2;
+#endif
+
+    struct Float4
+    {
+        static constexpr int LANES = 4;
+
+#if BULLSEYE_SIMD_SSE2
+        __m128 v;
+
+        static Float4 load(const float* p) noexcept { return {_mm_load_ps(p)}; }
+        static Float4 broadcast(float x) noexcept { return {_mm_set1_ps(x)}; }
+        void store(float* p) const noexcept { _mm_store_ps(p, v); }
+
+        friend Float4 operator*(Float4 a, Float4 b) noexcept { return {_mm_mul_ps(a.v, b.v)}; }
+        friend Float4 operator+(Float4 a, Float4 b) noexcept { return {_mm_add_ps(a.v, b.v)}; }
+        friend Float4 operator-(Float4 a, Float4 b) noexcept { return {_mm_sub_ps(a.v, b.v)}; }
+#elif BULLSEYE_SIMD_NEON
+        float32x4_t v;
+
+        static Float4 load(const float* p) noexcept { return {vld1q_f32(p)}; }
+        static Float4 broadcast(float x) noexcept { return {vdupq_n_f32(x)}; }
+        void store(float* p) const noexcept { vst1q_f32(p, v); }
+
+        friend Float4 operator*(Float4 a, Float4 b) noexcept { return {vmulq_f32(a.v, b.v)}; }
+        friend Float4 operator+(Float4 a, Float4 b) noexcept { return {vaddq_f32(a.v, b.v)}; }
+        friend Float4 operator-(Float4 a, Float4 b) noexcept { return {vsubq_f32(a.v, b.v)}; }
+#else
+        float v[4];
+
+        static Float4 load(const float* p) noexcept { return {{p[0], p[1], p[2], p[3]}}; }
+        static Float4 broadcast(float x) noexcept { return {{x, x, x, x}}; }
+        void store(float* p) const noexcept { for (int i = 0; i < 4; ++i) p[i] = v[i]; }
+
+        friend Float4 operator*(Float4 a, Float4 b) noexcept
+        {
+            return {{a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3]}};
+        }
+        friend Float4 operator+(Float4 a, Float4 b) noexcept
+        {
+            return {{a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3]}};
+        }
+        friend Float4 operator-(Float4 a, Float4 b) noexcept
+        {
+            return {{a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3]}};
+        }
+#endif
+    };
+
+#if BULLSEYE_SIMD_AVX
+    struct Float8
+    {
+        static constexpr int LANES = 8;
+
+        __m256 v;
+
+        static Float8 load(const float* p) noexcept { return {_mm256_load_ps(p)}; }
+        static Float8 broadcast(float x) noexcept { return {_mm256_set1_ps(x)}; }
+        void store(float* p) const noexcept { _mm256_store_ps(p, v); }
+
+        friend Float8 operator*(Float8 a, Float8 b) noexcept { return {_mm256_mul_ps(a.v, b.v)}; }
+        friend Float8 operator+(Float8 a, Float8 b) noexcept { return {_mm256_add_ps(a.v, b.v)}; }
+        friend Float8 operator-(Float8 a, Float8 b) noexcept { return {_mm256_sub_ps(a.v, b.v)}; }
+    };
+
+    using FloatN = Float8;
+#else
+    using FloatN = Float4;
+#endif
+
+    // Widest vector for a lane type
+    template<typename T> struct Widest;
+    template<> struct Widest<double> { using type = DoubleN; };
+    template<> struct Widest<float> { using type = FloatN; };
+
+    template<typename T>
+    using VectorN = typename Widest<T>::type;
+
+    // Alignment for arrays loaded with DoubleN or FloatN (same vector width)
+    constexpr int VECTOR_ALIGNMENT = DoubleN::LANES * static_cast<int>(sizeof(double));
+    static_assert(FloatN::LANES * sizeof(float) == VECTOR_ALIGNMENT, "float and double vectors must share a width");
+
+    // Round a channel count up to a whole number of vectors
+    constexpr int roundUpToLanes(int count, int lanes = DoubleN::LANES)
+    {
+        return ((count + lanes - 1) / lanes) * lanes;
+    }
+
+    /**
+     * std::vector allocator aligned to VECTOR_ALIGNMENT (never used on the audio thread)
+     */
+    template<typename T>
+    struct AlignedAllocator
+    {
+        using value_type = T;
+
+        AlignedAllocator() noexcept = default;
+        template<typename U>
+        AlignedAllocator(const AlignedAllocator<U>&) noexcept {}
+
+        T* allocate(std::size_t n)
+        {
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(VECTOR_ALIGNMENT)));
+        }
+        void deallocate(T* p, std::size_t) noexcept
+        {
+            ::operator delete(p, std::align_val_t(VECTOR_ALIGNMENT));
+        }
+
+        template<typename U>
+        bool operator==(const AlignedAllocator<U>&) const noexcept { return true; }
+        template<typename U>
+        bool operator!=(const AlignedAllocator<U>&) const noexcept { return false; }
+    };
+
+    template<typename T>
+    using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+
+    /**
+     * Length of the leading run of x[0..n) with |x| below threshold
+     * (NaN counts as below). Unaligned input; compares four floats or two
+     * doubles per instruction, then finds the first louder sample.
+     */
+    inline int leadingRunBelow(const float* x, int n, float threshold) noexcept
+    {
+        int i = 0;
+#if BULLSEYE_SIMD_SSE2
+        const __m128 limit = _mm_set1_ps(threshold);
+        const __m128 sign = _mm_set1_ps(-0.0f);
+        for (; i + 8 <= n; i += 8)
+        {
+            const __m128 a = _mm_andnot_ps(sign, _mm_loadu_ps(x + i));
+            const __m128 b = _mm_andnot_ps(sign, _mm_loadu_ps(x + i + 4));
+            if (_mm_movemask_ps(_mm_or_ps(_mm_cmpge_ps(a, limit), _mm_cmpge_ps(b, limit))) != 0)
+                break;
+        }
+#elif BULLSEYE_SIMD_NEON
+        const float32x4_t limit = vdupq_n_f32(threshold);
+        for (; i + 8 <= n; i += 8)
+        {
+            const uint32x4_t a = vcgeq_f32(vabsq_f32(vld1q_f32(x + i)), limit);
+            const uint32x4_t b = vcgeq_f32(vabsq_f32(vld1q_f32(x + i + 4)), limit);
+            if (vmaxvq_u32(vorrq_u32(a, b)) != 0)
+                break;
+        }
+#endif
+        for (; i < n; ++i)
+            if (std::abs(x[i]) >= threshold)
+                return i;
+        return n;
+    }
+
+    inline int leadingRunBelow(const double* x, int n, double threshold) noexcept
+    {
+        int i = 0;
+#if BULLSEYE_SIMD_SSE2
+        const __m128d limit = _mm_set1_pd(threshold);
+        const __m128d sign = _mm_set1_pd(-0.0);
+        for (; i + 4 <= n; i += 4)
+        {
+            const __m128d a = _mm_andnot_pd(sign, _mm_loadu_pd(x + i));
+            const __m128d b = _mm_andnot_pd(sign, _mm_loadu_pd(x + i + 2));
+            if (_mm_movemask_pd(_mm_or_pd(_mm_cmpge_pd(a, limit), _mm_cmpge_pd(b, limit))) != 0)
+                break;
+        }
+#elif BULLSEYE_SIMD_NEON
+        const float64x2_t limit = vdupq_n_f64(threshold);
+        for (; i + 4 <= n; i += 4)
+        {
+            const uint64x2_t a = vcgeq_f64(vabsq_f64(vld1q_f64(x + i)), limit);
+            const uint64x2_t b = vcgeq_f64(vabsq_f64(vld1q_f64(x + i + 2)), limit);
+            if (vmaxvq_u32(vreinterpretq_u32_u64(vorrq_u64(a, b))) != 0)
+                break;
+        }
+#endif
+        for (; i < n; ++i)
+            if (std::abs(x[i]) >= threshold)
+                return i;
+        return n;
+    }
+}
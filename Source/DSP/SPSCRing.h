@@ -0,0 +1,247 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include "../SSOT/ProcessorSSOT.h"
+
+/**
+ * SPSC Ring - bounded single-producer / single-consumer queue
+ *
+ * Producer (audio thread): push() is wait-free - one relaxed load of its
+ * own index, a cached copy of the consumer index (refreshed, with the
+ * consumer's read flag, only when the ring looks full), one slot copy and
+ * one release store. It never
+ * allocates, blocks or read-modify-writes an atomic. When the ring is full
+ * the new element is dropped and counted, so the oldest data survives.
+ * Consumer (one other thread): pop() / drain() take elements in order.
+ *
+ * setCapacity() and clear() belong to the producer side (never concurrently
+ * with push(), e.g. from prepareToPlay) and may run while the consumer
+ * drains. The consumer flags its reads (odd read counter) and only it
+ * writes the consumer index, which never goes back:
+ * - clear() publishes a discard mark that the consumer applies on its next
+ *   pop() / drain(). Cleared slots are reused once no read is in progress,
+ *   so a consumer that never runs (editor closed) does not block the producer.
+ * - setCapacity() allocates storage of exactly the new capacity, publishes
+ *   it with a discard mark at its first index, and frees the old storage
+ *   after any read that may still hold it has finished.
+ * Producer and consumer indices live on separate cache lines.
+ */
+template<typename T>
+class SPSCRing
+{
+public:
+    static_assert(std::is_trivially_copyable_v<T>, "SPSC ring elements are copied by value on the audio thread");
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "SPSC ring indices must be lock-free atomics");
+
+    SPSCRing() noexcept = default;
+    SPSCRing(const SPSCRing&) = delete;
+    SPSCRing& operator=(const SPSCRing&) = delete;
+
+    /**
+     * Make room for numElements and discard queued elements
+     * Not real-time safe: allocates when the capacity changes, and waits for
+     * a read in progress before freeing the old storage. Producer side, safe
+     * while the consumer drains
+     */
+    void setCapacity(std::size_t numElements)
+    {
+        clear();
+        if (numElements == producer.capacity)
+            return;
+
+        std::unique_ptr<Storage> retired = std::move(storage);
+        storage = (numElements > 0) ? std::make_unique<Storage>(numElements) : nullptr;
+        producer.capacity = numElements;
+        producer.reusableBefore = producer.discardMark;  // nothing in the new storage is being read
+
+        // A read that starts after this store sees the new storage (both seq_cst);
+        // one already in progress may still hold the old one
+        publishedStorage.store(storage.get(), std::memory_order_seq_cst);
+        const std::uint64_t reads = consumer.reads.load(std::memory_order_seq_cst);
+        if ((reads & 1) != 0)
+            while (consumer.reads.load(std::memory_order_acquire) == reads)
+                std::this_thread::yield();
+    }
+
+    std::size_t getCapacity() const noexcept { return producer.capacity; }
+
+    /**
+     * Discard queued elements and the drop count (producer side, safe while
+     * the consumer drains; it skips them on its next pop() / drain())
+     */
+    void clear() noexcept
+    {
+        producer.discardMark = producer.index.load(std::memory_order_relaxed);
+        producer.publishedDiscardMark.store(producer.discardMark, std::memory_order_seq_cst);
+        producer.droppedLocal = 0;
+        producer.dropped.store(0, std::memory_order_relaxed);
+    }
+
+    // ========================================================================
+    // PRODUCER (audio thread)
+    // ========================================================================
+
+    /**
+     * Append one element; returns false (and counts a drop) if the ring is full
+     */
+    bool push(const T& element) noexcept
+    {
+        const std::uint64_t write = producer.index.load(std::memory_order_relaxed);
+
+        if (isFull(write))
+        {
+            producer.cachedConsumerIndex = consumer.index.load(std::memory_order_acquire);
+
+            // Cleared slots the consumer has not skipped yet are free unless it is reading:
+            // any read that starts after this check sees the discard mark (both seq_cst)
+            if (isFull(write) && producer.reusableBefore < producer.discardMark
+                && (consumer.reads.load(std::memory_order_seq_cst) & 1) == 0)
+                producer.reusableBefore = producer.discardMark;
+
+            if (isFull(write))
+            {
+                producer.dropped.store(++producer.droppedLocal, std::memory_order_relaxed);
+                return false;
+            }
+        }
+
+        storage->slots[write % producer.capacity] = element;
+        producer.index.store(write + 1, std::memory_order_release);
+        return true;
+    }
+
+    // ========================================================================
+    // CONSUMER (one reader thread)
+    // ========================================================================
+
+    /**
+     * Take the oldest element; returns false if the ring is empty
+     */
+    bool pop(T& element) noexcept
+    {
+        const Read r = beginRead();
+        const bool available = r.begin != r.end;
+        if (available)
+        {
+            element = r.storage->slots[r.begin % r.storage->size];
+            consumer.index.store(r.begin + 1, std::memory_order_release);
+        }
+        endRead();
+        return available;
+    }
+
+    /**
+     * Hand every queued element to fn(const T&) in order; returns the count
+     * Elements pushed while draining are left for the next call
+     */
+    template<typename Fn>
+    std::size_t drain(Fn&& fn)
+    {
+        const Read r = beginRead();
+
+        for (std::uint64_t i = r.begin; i < r.end; ++i)
+            fn(static_cast<const T&>(r.storage->slots[i % r.storage->size]));
+
+        consumer.index.store(r.end, std::memory_order_release);
+        endRead();
+        return static_cast<std::size_t>(r.end - r.begin);
+    }
+
+    /**
+     * Elements waiting to be read (approximate while the producer runs)
+     */
+    std::size_t size() const noexcept
+    {
+        const std::uint64_t read = std::max(consumer.index.load(std::memory_order_relaxed),
+                                            producer.publishedDiscardMark.load(std::memory_order_acquire));
+        return static_cast<std::size_t>(producer.index.load(std::memory_order_acquire) - read);
+    }
+
+    /**
+     * Elements dropped because the ring was full
+     */
+    std::uint64_t getDroppedCount() const noexcept
+    {
+        return producer.dropped.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr std::size_t CACHE_LINE = ProcessorSSOT::Performance::CACHE_LINE_PADDING;
+
+    // Written by the producer only
+    struct alignas(CACHE_LINE) Producer
+    {
+        std::atomic<std::uint64_t> index{0};
+        std::uint64_t cachedConsumerIndex{0};
+        std::uint64_t droppedLocal{0};
+        std::atomic<std::uint64_t> dropped{0};
+        std::size_t capacity{0};                                // size of storage
+        std::uint64_t discardMark{0};                           // elements before it were cleared
+        std::uint64_t reusableBefore{0};                        // cleared slots below it may be overwritten
+        std::atomic<std::uint64_t> publishedDiscardMark{0};     // discardMark, for the consumer
+    };
+
+    // Written by the consumer only
+    struct alignas(CACHE_LINE) Consumer
+    {
+        std::atomic<std::uint64_t> index{0};
+        std::atomic<std::uint64_t> reads{0};                    // odd while pop() / drain() reads slots
+    };
+
+    struct Storage
+    {
+        explicit Storage(std::size_t numElements) : slots(std::make_unique<T[]>(numElements)), size(numElements) {}
+
+        std::unique_ptr<T[]> slots;
+        std::size_t size;
+    };
+
+    // Elements [begin, end) of one storage, claimed by beginRead()
+    struct Read
+    {
+        const Storage* storage;
+        std::uint64_t begin;
+        std::uint64_t end;
+    };
+
+    Producer producer;
+    Consumer consumer;
+    std::unique_ptr<Storage> storage;                          // owned by the producer side
+    std::atomic<const Storage*> publishedStorage{nullptr};     // storage, for the consumer
+
+    /**
+     * Full when the next slot may still be read (queued elements, or cleared
+     * elements the consumer has not skipped yet)
+     */
+    bool isFull(std::uint64_t write) const noexcept
+    {
+        const std::uint64_t read = std::max(producer.cachedConsumerIndex, producer.reusableBefore);
+        return write - read >= producer.capacity;
+    }
+
+    /**
+     * Flag a read in progress and claim the queued elements, past anything
+     * the producer has cleared. The producer index is loaded first: elements
+     * it covers were pushed into this storage or before the discard mark
+     */
+    Read beginRead() noexcept
+    {
+        consumer.reads.store(consumer.reads.load(std::memory_order_relaxed) + 1, std::memory_order_seq_cst);
+        const std::uint64_t end = producer.index.load(std::memory_order_acquire);
+        const Storage* current = publishedStorage.load(std::memory_order_seq_cst);
+        const std::uint64_t begin = std::max(consumer.index.load(std::memory_order_relaxed),
+                                             producer.publishedDiscardMark.load(std::memory_order_seq_cst));
+        return {current, begin, std::max(begin, end)};
+    }
+
+    void endRead() noexcept
+    {
+        consumer.reads.store(consumer.reads.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+};
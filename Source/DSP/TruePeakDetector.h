@@ -0,0 +1,407 @@
+#pragma once
+
+#include <cmath>
+#include <algorithm>
+#include "SIMDTypes.h"
+#include "../SSOT/DSPSSOT.h"
+
+/**
+ * True Peak Detector - polyphase FIR oversampling (ITU-R BS.1770-4 Annex 2)
+ *
+ * Interpolates each channel with the Annex 2 48-tap, 4-phase FIR and
+ * tracks the running maximum of |x| over the input and all interpolated
+ * phases. The oversampling factor is chosen from the sample rate:
+ *   4x: all four phases (44.1 / 48 kHz)
+ *   2x: phases 0 and 2 (88.2 / 96 kHz)
+ *   1x: sample peak only (176.4 kHz and above)
+ *
+ * The kernel is templated on the factor and computes all phases of one
+ * input sample at once: the phases sit in SIMD lanes, each tap is one
+ * multiply-add against a broadcast history sample. History is a mirrored
+ * buffer (every sample written twice, TAPS apart), so the last 12 samples
+ * are always contiguous and no modulo is needed in the dot product.
+ *
+ * Interpolated values lag the input by ~6 samples (FIR group delay);
+ * the plain sample peak is tracked without delay.
+ *
+ * Early out (EarlyOut = true): no phase output can exceed its L1 norm
+ * times the largest |x| in its 12-sample window. Input is taken in runs
+ * of EARLY_OUT_RUN samples; when that bound over the run and the 11
+ * samples before it is at or below the channel's running peak (or this
+ * call's), the run only updates the history and the sample peak. Running
+ * peaks are identical to evaluating every output; once a loud passage has
+ * set the peak, quieter material skips most of the interpolation. Calls
+ * shorter than a run (the per-sample path) evaluate every output.
+ *
+ * The window peak (takeWindowPeak) restarts every hop, so it does not
+ * gate the early out; a skipped run adds its bound instead. Window peaks
+ * are then an upper estimate: never below the exact value, never above
+ * the running peak, and exact for windows without skipped runs.
+ *
+ * Real-time safe: no allocation, no locks, no transcendental functions.
+ */
+template<int MaxChannels, bool EarlyOut = true>
+class TruePeakDetector
+{
+public:
+    static constexpr int TAPS = DSPSSOT::TruePeak::FIR_TAPS_PER_PHASE;
+    static constexpr int PHASES = DSPSSOT::TruePeak::FIR_PHASES;
+
+    TruePeakDetector() noexcept
+    {
+        reset();
+    }
+
+    /**
+     * Select oversampling (4, 2 or 1); other values are ignored
+     * Changing the factor clears the interpolation history (peaks are kept)
+     */
+    void setOversamplingFactor(int newFactor) noexcept
+    {
+        if (newFactor != 4 && newFactor != 2 && newFactor != 1)
+            return;
+
+        if (newFactor != factor)
+        {
+            factor = newFactor;
+            resetHistory();
+        }
+    }
+
+    int getOversamplingFactor() const noexcept { return factor; }
+
+    /**
+     * Clear history and peaks for all channels
+     */
+    void reset() noexcept
+    {
+        resetHistory();
+        resetPeaks();
+    }
+
+    /**
+     * Clear peaks but keep the interpolation history
+     * (the next output still sees the samples that precede it)
+     */
+    void resetPeaks() noexcept
+    {
+        std::fill(channelPeak, channelPeak + MaxChannels, 0.0);
+        peakMax = 0.0;
+        windowPeak = 0.0;
+    }
+
+    /**
+     * Take the larger of each running peak and another detector's
+     */
+    void mergePeaks(const TruePeakDetector& other) noexcept
+    {
+        for (int ch = 0; ch < MaxChannels; ++ch)
+            channelPeak[ch] = std::max(channelPeak[ch], other.channelPeak[ch]);
+        peakMax = std::max(peakMax, other.peakMax);
+    }
+
+    /**
+     * Track the True Peak of one channel over a run of samples
+     * EDGE CASE: NaN/infinity and denormal samples are flushed to zero
+     */
+    template<typename SampleType>
+    void process(int channel, const SampleType* samples, int numSamples) noexcept
+    {
+        switch (factor)
+        {
+            case 4:  processChannel<4>(channel, samples, numSamples); break;
+            case 2:  processChannel<2>(channel, samples, numSamples); break;
+            default: processChannel<1>(channel, samples, numSamples); break;
+        }
+    }
+
+    /**
+     * Running True Peak (linear) across all channels
+     */
+    double getPeak() const noexcept { return peakMax; }
+
+    /**
+     * True Peak (linear) across all channels since the previous call, then restart
+     * (per-hop peaks for the loudness history stream; with the early out, an
+     * upper estimate bounded by the running peak)
+     */
+    double takeWindowPeak() noexcept
+    {
+        const double peak = windowPeak;
+        windowPeak = 0.0;
+        return peak;
+    }
+
+    /**
+     * True if the interpolation history of the first numChannels channels is all zero
+     * (silent input then leaves every peak unchanged and needs no processing)
+     */
+    bool isHistorySilent(int numChannels) const noexcept
+    {
+        numChannels = std::min(numChannels, MaxChannels);
+        for (int ch = 0; ch < numChannels; ++ch)
+            for (int i = 0; i < TAPS; ++i)
+                if (history[ch][i] != 0.0)
+                    return false;
+        return true;
+    }
+
+    /**
+     * Input samples whose phases were interpolated since construction
+     * (the early out skipped the rest)
+     */
+    long long getInterpolatedSamples() const noexcept { return interpolatedSamples; }
+
+    /**
+     * Running True Peak (linear) of one channel
+     */
+    double getChannelPeak(int channel) const noexcept { return channelPeak[channel]; }
+
+    /**
+     * Annex 2 coefficient of one phase: phase 2 mirrors phase 1, phase 3 mirrors phase 0
+     */
+    static constexpr double coefficient(int phase, int tap) noexcept
+    {
+        return (phase < 2) ? BASE_PHASES[phase][tap] : BASE_PHASES[PHASES - 1 - phase][TAPS - 1 - tap];
+    }
+
+private:
+    using Vector = SIMD::Double2;
+
+    // ITU-R BS.1770-4 Annex 2, phases 0 and 1 (phases 2 and 3 are their mirror images)
+    static constexpr double BASE_PHASES[2][TAPS] = {
+        { 0.0017089843750,  0.0109863281250, -0.0196533203125,  0.0332031250000,
+         -0.0594482421875,  0.1373291015625,  0.9721679687500, -0.1022949218750,
+          0.0476074218750, -0.0266113281250,  0.0148925781250, -0.0083007812500},
+        {-0.0291748046875,  0.0292968750000, -0.0517578125000,  0.0891113281250,
+         -0.1665039062500,  0.4650878906250,  0.7797851562500, -0.2003173828125,
+          0.1015625000000, -0.0582275390625,  0.0330810546875, -0.0189208984375}
+    };
+
+    /**
+     * Coefficients for one factor, ordered for the history window:
+     * row j multiplies window[j] (oldest first), column = output phase lane
+     * overshoot: largest L1 norm of the phases used, so |y| <= overshoot * max|window|
+     * (raised by a margin far above the FIR's rounding error)
+     */
+    template<int Factor>
+    struct PolyphaseTable
+    {
+        alignas(SIMD::VECTOR_ALIGNMENT) double c[TAPS][Factor]{};
+        double overshoot{0.0};
+
+        constexpr PolyphaseTable() noexcept
+        {
+            for (int j = 0; j < TAPS; ++j)
+                for (int lane = 0; lane < Factor; ++lane)
+                    c[j][lane] = coefficient(lane * (PHASES / Factor), TAPS - 1 - j);
+
+            for (int lane = 0; lane < Factor; ++lane)
+            {
+                double norm = 0.0;
+                for (int j = 0; j < TAPS; ++j)
+                    norm += (c[j][lane] < 0.0) ? -c[j][lane] : c[j][lane];
+                overshoot = (norm > overshoot) ? norm : overshoot;
+            }
+            overshoot *= 1.0 + 1e-9;
+        }
+    };
+
+    template<int Factor>
+    static constexpr PolyphaseTable<Factor> TABLE{};
+
+    // Mirrored history: sample n is stored at [pos] and [pos + TAPS]
+    alignas(SIMD::VECTOR_ALIGNMENT) double history[MaxChannels][2 * TAPS]{};
+    int writePos[MaxChannels]{};
+    double channelPeak[MaxChannels]{};
+    double peakMax{0.0};
+    double windowPeak{0.0};
+    long long interpolatedSamples{0};
+    int factor{DSPSSOT::TruePeak::OVERSAMPLE_FACTOR};
+
+    void resetHistory() noexcept
+    {
+        for (int ch = 0; ch < MaxChannels; ++ch)
+        {
+            std::fill(history[ch], history[ch] + 2 * TAPS, 0.0);
+            writePos[ch] = 0;
+        }
+    }
+
+    /**
+     * Largest |x| of the TAPS - 1 newest history samples (the part of the
+     * next outputs' windows that precedes them)
+     */
+    static double recentPeak(const double* buffer, int pos) noexcept
+    {
+        double recent = 0.0;
+        for (int j = 1; j < TAPS; ++j)
+            recent = std::max(recent, std::abs(buffer[pos + j]));
+        return recent;
+    }
+
+    static double sanitize(double sample) noexcept
+    {
+        if (std::isnan(sample) || std::isinf(sample))
+            sample = 0.0;
+        if (std::abs(sample) < DSPSSOT::TruePeak::DENORM_THRESHOLD)
+            sample = 0.0;
+        return sample;
+    }
+
+    /**
+     * Append one sample to a channel's mirrored history
+     */
+    static void push(double* buffer, int& pos, double x) noexcept
+    {
+        buffer[pos] = x;
+        buffer[pos + TAPS] = x;
+        pos = (pos + 1 == TAPS) ? 0 : pos + 1;
+    }
+
+    /**
+     * All phases of the newest sample into the running phase peaks
+     * window: last TAPS samples, oldest first (newest at window[TAPS - 1])
+     */
+    template<int Factor>
+    static void interpolate(const double* window, Vector (&phasePeak)[Factor / Vector::LANES]) noexcept
+    {
+        const PolyphaseTable<Factor>& table = TABLE<Factor>;
+
+        for (int v = 0; v < Factor / Vector::LANES; ++v)
+        {
+            const double* c = &table.c[0][v * Vector::LANES];
+            Vector acc = Vector::load(c) * Vector::broadcast(window[0]);
+            for (int j = 1; j < TAPS; ++j)
+                acc = acc + Vector::load(c + j * Factor) * Vector::broadcast(window[j]);
+
+            phasePeak[v] = max(phasePeak[v], abs(acc));
+        }
+    }
+
+    /**
+     * Every phase output of a run of samples; returns the run's peak
+     */
+    template<int Factor, typename SampleType>
+    double interpolateAll(int channel, const SampleType* samples, int numSamples) noexcept
+    {
+        constexpr int VECTORS = Factor / Vector::LANES;
+        double* buffer = history[channel];
+        int pos = writePos[channel];
+        double peak = 0.0;
+
+        Vector phasePeak[VECTORS];
+        for (int v = 0; v < VECTORS; ++v)
+            phasePeak[v] = Vector::broadcast(0.0);
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const double x = sanitize(static_cast<double>(samples[i]));
+            push(buffer, pos, x);
+            interpolate<Factor>(buffer + pos, phasePeak);
+            peak = std::max(peak, std::abs(x));
+        }
+        interpolatedSamples += numSamples;
+
+        for (int v = 0; v < VECTORS; ++v)
+            peak = std::max(peak, phasePeak[v].maxLane());
+
+        writePos[channel] = pos;
+        return peak;
+    }
+
+    /**
+     * Early out: runs of EARLY_OUT_RUN samples whose bound cannot raise the
+     * running peak only update the history (their bound goes to the window
+     * peak); the others and the tail are interpolated. Returns the peak
+     * evaluating every output would give.
+     */
+    template<int Factor, typename SampleType>
+    double interpolateBounded(int channel, const SampleType* samples, int numSamples) noexcept
+    {
+        constexpr int VECTORS = Factor / Vector::LANES;
+        constexpr int RUN = DSPSSOT::TruePeak::EARLY_OUT_RUN;
+        double* buffer = history[channel];
+        int pos = writePos[channel];
+        double peak = 0.0;
+
+        // Peak an output must exceed to change the running peak (besides this call's own)
+        const double limit = channelPeak[channel];
+        double skippedBound = 0.0;
+
+        int start = 0;
+        for (; start + RUN <= numSamples; start += RUN)
+        {
+            double x[RUN];
+            double inputPeak = 0.0;
+            for (int i = 0; i < RUN; ++i)
+            {
+                x[i] = sanitize(static_cast<double>(samples[start + i]));
+                inputPeak = std::max(inputPeak, std::abs(x[i]));
+            }
+
+            const double bound = std::max(inputPeak, recentPeak(buffer, pos)) * TABLE<Factor>.overshoot;
+
+            if (bound <= std::max(peak, limit))
+            {
+                for (int i = 0; i < RUN; ++i)
+                    push(buffer, pos, x[i]);
+                skippedBound = std::max(skippedBound, std::min(bound, limit));
+            }
+            else
+            {
+                Vector phasePeak[VECTORS];
+                for (int v = 0; v < VECTORS; ++v)
+                    phasePeak[v] = Vector::broadcast(0.0);
+
+                for (int i = 0; i < RUN; ++i)
+                {
+                    push(buffer, pos, x[i]);
+                    interpolate<Factor>(buffer + pos, phasePeak);
+                }
+                interpolatedSamples += RUN;
+
+                for (int v = 0; v < VECTORS; ++v)
+                    peak = std::max(peak, phasePeak[v].maxLane());
+            }
+            peak = std::max(peak, inputPeak);
+        }
+
+        writePos[channel] = pos;
+        windowPeak = std::max(windowPeak, skippedBound);
+        if (start < numSamples)
+            peak = std::max(peak, interpolateAll<Factor>(channel, samples + start, numSamples - start));
+        return peak;
+    }
+
+    template<int Factor, typename SampleType>
+    void processChannel(int channel, const SampleType* samples, int numSamples) noexcept
+    {
+        double peak = 0.0;  // this run only
+
+        if constexpr (Factor == 1)
+        {
+            for (int i = 0; i < numSamples; ++i)
+                peak = std::max(peak, std::abs(sanitize(static_cast<double>(samples[i]))));
+        }
+        else if constexpr (EarlyOut)
+        {
+            // Calls shorter than a run (per-sample callers): the bound costs more than it saves
+            peak = (numSamples >= DSPSSOT::TruePeak::EARLY_OUT_RUN)
+                 ? interpolateBounded<Factor>(channel, samples, numSamples)
+                 : interpolateAll<Factor>(channel, samples, numSamples);
+        }
+        else
+        {
+            peak = interpolateAll<Factor>(channel, samples, numSamples);
+        }
+
+        // EDGE CASE: Clamp peak to prevent overflow
+        constexpr double MAX_PEAK = 1e10;
+        peak = std::min(peak, MAX_PEAK);
+
+        channelPeak[channel] = std::max(channelPeak[channel], peak);
+        peakMax = std::max(peakMax, peak);
+        windowPeak = std::max(windowPeak, peak);
+    }
+};
@@ -7,6 +7,7 @@
 BULLsEYEEditor::BULLsEYEEditor(BULLsEYEProcessor& p)
     : juce::AudioProcessorEditor(p)
     , audioProcessor(p)
+    , loudnessTimeline(p.getLoudnessTimeline())
 {
     setSize(UISSOT::Dimensions::DEFAULT_WINDOW_WIDTH,
             UISSOT::Dimensions::DEFAULT_WINDOW_HEIGHT);
@@ -15,6 +16,15 @@ BULLsEYEEditor::BULLsEYEEditor(BULLsEYEProcessor& p)
     addAndMakeVisible(statusDisplay);
     addAndMakeVisible(modeSelector);
     addAndMakeVisible(circularMeter);
+    addAndMakeVisible(loudnessTimeline);
+
+#if BULLSEYE_ENABLE_TIMING
+    timingOverlay.setFont(UISSOT::Typography::meterFont());
+    timingOverlay.setColour(juce::Label::textColourId, UISSOT::Colors::textSecondary());
+    timingOverlay.setJustificationType(juce::Justification::centredRight);
+    timingOverlay.setInterceptsMouseClicks(false, false);
+    addAndMakeVisible(timingOverlay);
+#endif
 
     // Connect mode selector to APVTS
     modeSelector.setAPVTS(&audioProcessor.getAPVTS());
@@ -51,14 +61,24 @@ void BULLsEYEEditor::resized()
     auto bounds = getLocalBounds();
 
     // Header (painted in paint(), reserve space)
+#if BULLSEYE_ENABLE_TIMING
+    timingOverlay.setBounds(bounds.removeFromTop(UISSOT::Dimensions::HEADER_HEIGHT)
+                                  .removeFromRight(UISSOT::Dimensions::TIMELINE_WIDTH)
+                                  .reduced(UISSOT::Dimensions::MARGIN_MEDIUM, 0));
+#else
     bounds.removeFromTop(UISSOT::Dimensions::HEADER_HEIGHT);
+#endif
+
+    // Loudness timeline on the right, meters keep their column on the left
+    loudnessTimeline.setBounds(bounds.removeFromRight(UISSOT::Dimensions::TIMELINE_WIDTH)
+                                     .reduced(UISSOT::Dimensions::MARGIN_MEDIUM, 0));
 
     // Mode selector (label 20px + combo 28px + padding 8px = 56px)
     bounds.removeFromTop(UISSOT::Dimensions::MARGIN_SMALL);
     modeSelector.setBounds(bounds.removeFromTop(56));
     bounds.removeFromTop(UISSOT::Dimensions::MARGIN_SMALL);
 
-    // Status display (LUFS-I, deviation bar, True Peak)
+    // Status display (LUFS-I, deviation bar, M/S, True Peak)
     statusDisplay.setBounds(bounds.removeFromTop(120));
     bounds.removeFromTop(UISSOT::Dimensions::MARGIN_SMALL);
 
@@ -72,27 +92,73 @@ void BULLsEYEEditor::resized()
 
 void BULLsEYEEditor::timerCallback()
 {
-    updateStatusDisplay();
-    updateCircularMeter();
+    // One consistent snapshot per UI frame, shared by every component
+    const MeterFrame frame = audioProcessor.getMeterFrame();
+
+    updateStatusDisplay(frame);
+    updateCircularMeter(frame);
+    updateLoudnessTimeline(frame);
+
+#if BULLSEYE_ENABLE_TIMING
+    updateTimingOverlay();
+#endif
 }
 
-void BULLsEYEEditor::updateStatusDisplay()
+void BULLsEYEEditor::updateStatusDisplay(const MeterFrame& frame)
 {
     statusDisplay.setValues(
-        audioProcessor.getIntegratedLUFS(),
-        audioProcessor.getTruePeakDB(),
-        audioProcessor.getDeviationLU(),
-        audioProcessor.getContentType()
+        frame.integratedLUFS,
+        frame.truePeakDB,
+        frame.deviationLU,
+        frame.contentType
     );
+
+    statusDisplay.setWindowedLoudness(
+        frame.momentaryLUFS,
+        frame.shortTermLUFS,
+        frame.maxMomentaryLUFS,
+        frame.maxShortTermLUFS
+    );
+
+    statusDisplay.setLoudnessRange(frame.loudnessRangeLU);
 }
 
-void BULLsEYEEditor::updateCircularMeter()
+void BULLsEYEEditor::updateCircularMeter(const MeterFrame& frame)
 {
     // Update circular meter with all current values
     circularMeter.setValues(
-        audioProcessor.getIntegratedLUFS(),
-        audioProcessor.getTruePeakDB(),
-        audioProcessor.getDeviationLU(),
-        audioProcessor.getContentType()
+        frame.integratedLUFS,
+        frame.truePeakDB,
+        frame.deviationLU,
+        frame.contentType
+    );
+
+    circularMeter.setWindowedLoudness(
+        frame.momentaryLUFS,
+        frame.shortTermLUFS
     );
 }
+
+void BULLsEYEEditor::updateLoudnessTimeline(const MeterFrame& frame)
+{
+    // Move every hop the audio thread queued since the last tick into the timeline
+    LoudnessTimeline& timeline = audioProcessor.getLoudnessTimeline();
+    const std::size_t numNew = audioProcessor.drainLoudnessHistory(
+        [&timeline](const LoudnessHopRecord& record) { timeline.addFrame(record); });
+
+    loudnessTimeline.setTargetLUFS(ModelSSOT::Helpers::getTargetLUFS(frame.contentType));
+
+    if (numNew > 0)
+        loudnessTimeline.repaint();
+}
+
+#if BULLSEYE_ENABLE_TIMING
+void BULLsEYEEditor::updateTimingOverlay()
+{
+    if (--timingRefreshCountdown > 0)
+        return;
+
+    timingRefreshCountdown = UISSOT::Timing::UI_REFRESH_RATE_HZ / UISSOT::Timing::DIAGNOSTICS_REFRESH_RATE_HZ;
+    timingOverlay.setText(formatTimingSummary(audioProcessor.getCallbackTimingStats()), juce::dontSendNotification);
+}
+#endif
@@ -8,6 +8,7 @@
 #include "Components/StatusDisplayComponent.h"
 #include "Components/ModeSelectorComponent.h"
 #include "Components/CircularMeterComponent.h"
+#include "Components/LoudnessTimelineComponent.h"
 
 /**
  * BULLsEYE Audio Processor Editor
@@ -50,14 +51,25 @@ private:
     StatusDisplayComponent statusDisplay;
     ModeSelectorComponent modeSelector;
     CircularMeterComponent circularMeter;
+    LoudnessTimelineComponent loudnessTimeline;
+
+#if BULLSEYE_ENABLE_TIMING
+    // Callback timing overlay (header, right), refreshed a few times per second
+    juce::Label timingOverlay;
+    int timingRefreshCountdown{0};
+#endif
 
     // ========================================================================
     // HELPER METHODS
     // ========================================================================
 
-    void updateStatusDisplay();
+    void updateStatusDisplay(const MeterFrame& frame);
     void updateModeSelector();
-    void updateCircularMeter();
+    void updateCircularMeter(const MeterFrame& frame);
+    void updateLoudnessTimeline(const MeterFrame& frame);
+#if BULLSEYE_ENABLE_TIMING
+    void updateTimingOverlay();
+#endif
 
     // ========================================================================
     // JUCE MACROS
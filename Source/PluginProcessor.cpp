@@ -57,11 +57,20 @@ void BULLsEYEProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
     // Initialize DSP core
     dspCore.setSampleRate(sampleRate);
+    updateChannelWeights();
     dspCore.reset();
 
+    // Loudness history stream (allocates when the capacity changes; audio is
+    // not running here, the editor may still be draining)
+    dspCore.setHistoryCapacity(ProcessorSSOT::History::capacityForSeconds(historyCapacitySeconds));
+
     // Reset transport state tracking
     wasPlaying = false;
 
+#if BULLSEYE_ENABLE_TIMING
+    callbackTimer.prepare(sampleRate);
+#endif
+
     // Notify parameter changes
     contentTypeChanged();
 }
@@ -74,23 +83,71 @@ void BULLsEYEProcessor::releaseResources()
 #ifndef JucePlugin_PreferredChannelConfigurations
 bool BULLsEYEProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
 {
-    // Only support stereo
-    if (layouts.getMainInputChannelSet() != juce::AudioChannelSet::stereo())
-        return false;
+    const auto input = layouts.getMainInputChannelSet();
 
-    if (layouts.getMainOutputChannelSet() != juce::AudioChannelSet::stereo())
+    // Meter plugin: output layout must match input (passthrough)
+    if (layouts.getMainOutputChannelSet() != input)
         return false;
 
-    return true;
+    // Mono, stereo, 5.1, 7.1 and 7.1.4 (measured by one core)
+    return input == juce::AudioChannelSet::mono()
+        || input == juce::AudioChannelSet::stereo()
+        || input == juce::AudioChannelSet::create5point1()
+        || input == juce::AudioChannelSet::create7point1()
+        || input == juce::AudioChannelSet::create7point1point4();
 }
 #endif
 
+// ========================================================================
+// CHANNEL WEIGHTING
+// ========================================================================
+
+void BULLsEYEProcessor::updateChannelWeights()
+{
+    // ITU-R BS.1770 channel gains derived from the host's channel types
+    const auto layout = getChannelLayoutOfBus(true, 0);
+    const int numChannels = juce::jmin(layout.size(), ProcessorSSOT::Channels::MAX_INPUT_CHANNELS);
+
+    double weights[ProcessorSSOT::Channels::MAX_INPUT_CHANNELS];
+
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        switch (layout.getTypeOfChannel(ch))
+        {
+            case juce::AudioChannelSet::LFE:
+            case juce::AudioChannelSet::LFE2:
+                weights[ch] = DSPSSOT::ChannelWeighting::LFE;
+                break;
+
+            case juce::AudioChannelSet::leftSurround:
+            case juce::AudioChannelSet::rightSurround:
+            case juce::AudioChannelSet::leftSurroundSide:
+            case juce::AudioChannelSet::rightSurroundSide:
+            case juce::AudioChannelSet::leftSurroundRear:
+            case juce::AudioChannelSet::rightSurroundRear:
+            case juce::AudioChannelSet::centreSurround:
+                weights[ch] = DSPSSOT::ChannelWeighting::SURROUND;
+                break;
+
+            default:
+                weights[ch] = DSPSSOT::ChannelWeighting::FRONT;
+                break;
+        }
+    }
+
+    dspCore.setChannelWeights(weights, numChannels);
+}
+
 // ========================================================================
 // PROCESSING
 // ========================================================================
 
 void BULLsEYEProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer&)
 {
+#if BULLSEYE_ENABLE_TIMING
+    const CallbackTimer::Scope timing(callbackTimer, buffer.getNumSamples());
+#endif
+
     juce::ScopedNoDenormals noDenormals;
 
     // Transport state detection using DAW playhead (reliable across all DAWs)
@@ -117,15 +174,10 @@ void BULLsEYEProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::Mid
     // Poll content type parameter each block (equivalent to JSFX @slider)
     contentTypeChanged();
 
-    // Get input and output pointers
-    float* leftIn = buffer.getWritePointer(0);
-    float* rightIn = buffer.getWritePointer(1);
-
-    // Process each sample
-    for (int i = 0; i < buffer.getNumSamples(); i++)
-    {
-        dspCore.process(leftIn[i], rightIn[i]);
-    }
+    // Meter plugin: read-only access, audio passes through untouched
+    // Process the whole host block, all input channels into one gated integrator
+    const int numChannels = juce::jmin(getTotalNumInputChannels(), buffer.getNumChannels());
+    dspCore.processBlock(buffer.getArrayOfReadPointers(), numChannels, buffer.getNumSamples());
 }
 
 // ========================================================================
@@ -3,7 +3,11 @@
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_audio_utils/juce_audio_utils.h>
 #include "SSOT/ModelSSOT.h"
+#include "SSOT/DSPSSOT.h"
+#include "SSOT/ProcessorSSOT.h"
 #include "DSP/BULLsEYEProcessor.h"
+#include "DSP/CallbackTiming.h"
+#include "DSP/LoudnessTimeline.h"
 
 /**
  * BULLsEYE Audio Processor
@@ -79,13 +83,51 @@ public:
     // METER ACCESS (for UI)
     // ========================================================================
 
+    MeterFrame getMeterFrame() const { return dspCore.getMeterFrame(); }
     float getNormalizedLUFS() const { return dspCore.getNormalizedLUFS(); }
     float getNormalizedTruePeak() const { return dspCore.getNormalizedTruePeak(); }
     double getIntegratedLUFS() const { return dspCore.getIntegratedLUFS(); }
     double getTruePeakDB() const { return dspCore.getTruePeakDB(); }
     double getDeviationLU() const { return dspCore.getDeviationLU(); }
+    double getMomentaryLUFS() const { return dspCore.getMomentaryLUFS(); }
+    double getShortTermLUFS() const { return dspCore.getShortTermLUFS(); }
+    double getMaxMomentaryLUFS() const { return dspCore.getMaxMomentaryLUFS(); }
+    double getMaxShortTermLUFS() const { return dspCore.getMaxShortTermLUFS(); }
+    double getLoudnessRangeLU() const { return dspCore.getLoudnessRangeLU(); }
     ModelSSOT::ContentType getContentType() const { return dspCore.getContentType(); }
 
+    // ========================================================================
+    // LOUDNESS HISTORY (one record per 100 ms hop, single reader)
+    // ========================================================================
+
+    /**
+     * Drain queued hop records (message thread) into fn(const LoudnessHopRecord&)
+     */
+    template<typename Fn>
+    std::size_t drainLoudnessHistory(Fn&& fn) { return dspCore.drainHistory(std::forward<Fn>(fn)); }
+
+    /**
+     * How much history is kept while nobody drains it (applied at the next prepareToPlay)
+     */
+    void setHistoryCapacitySeconds(double seconds) { historyCapacitySeconds = seconds; }
+
+    /**
+     * Session loudness timeline (message thread only; fed by the editor from
+     * drainLoudnessHistory, so it survives the editor being closed)
+     */
+    LoudnessTimeline& getLoudnessTimeline() { return loudnessTimeline; }
+
+#if BULLSEYE_ENABLE_TIMING
+    // ========================================================================
+    // CALLBACK TIMING (diagnostics builds only)
+    // ========================================================================
+
+    /**
+     * processBlock duration / budget statistics since the last prepareToPlay (any thread)
+     */
+    CallbackTimingStats getCallbackTimingStats() const { return callbackTimer.getStats(); }
+#endif
+
 private:
     // ========================================================================
     // PRIVATE MEMBERS
@@ -97,6 +139,14 @@ private:
     // Transport state detection using DAW playhead
     bool wasPlaying{false};  // Track previous transport state for stop→play detection
 
+    // Loudness history capacity (sized in prepareToPlay)
+    double historyCapacitySeconds{ProcessorSSOT::History::DEFAULT_CAPACITY_SECONDS};
+    LoudnessTimeline loudnessTimeline;
+
+#if BULLSEYE_ENABLE_TIMING
+    CallbackTimer callbackTimer;
+#endif
+
     // ========================================================================
     // PARAMETER LAYOUT
     // ========================================================================
@@ -109,6 +159,12 @@ private:
 
     void contentTypeChanged();
 
+    // ========================================================================
+    // CHANNEL WEIGHTING
+    // ========================================================================
+
+    void updateChannelWeights();
+
     // ========================================================================
     // JUCE MACROS
     // ========================================================================
@@ -30,6 +30,39 @@ namespace DSPSSOT
         constexpr double HIGH_SHELF_GAIN_DB = 4.0;   // Gain in dB
     }
 
+    // ==========================================
+    // HIGH-RATE LOUDNESS PATH (optional halfband decimation)
+    // ==========================================
+    namespace HighRate
+    {
+        // At 176.4 kHz and above, K-weighting and gating may run on a
+        // halfband-decimated copy of the input; each 2:1 stage keeps the
+        // output at 44.1 kHz or more (176.4k -> 44.1k, 192k / 384k -> 48k)
+        constexpr double MIN_DECIMATION_RATE = 176400.0;
+        constexpr double MIN_OUTPUT_RATE = 44100.0;
+        constexpr int MAX_DECIMATION_FACTOR = 16;
+
+        // Decimator passband; content above it is not measured
+        constexpr double PASSBAND_HZ = 20000.0;
+
+        // Loudness (integrated, momentary, short-term) of programme band-limited
+        // to PASSBAND_HZ stays within this bound of the native-rate measurement.
+        // The decimator adds < 0.001 LU; the rest is K-weighting at 44.1 / 48 kHz,
+        // whose shelf departs from the high-rate response near 20 kHz
+        // (0.09 LU for full-level tones up to 19 kHz, far less on real programme)
+        constexpr double ACCURACY_BOUND_LU = 0.1;
+    }
+
+    // ==========================================
+    // CHANNEL WEIGHTING (ITU-R BS.1770 G_i)
+    // ==========================================
+    namespace ChannelWeighting
+    {
+        constexpr double FRONT = 1.0;       // L, R, C and height channels
+        constexpr double SURROUND = 1.41;   // Ls, Rs and side/rear surrounds (+1.5 dB)
+        constexpr double LFE = 0.0;         // LFE is excluded from the measurement
+    }
+
     // ==========================================
     // GATED INTEGRATION PARAMETERS
     // ==========================================
@@ -39,6 +72,11 @@ namespace DSPSSOT
         // Calculated as: max(1, floor(0.400 * srate))
         constexpr double BLOCK_DURATION_MS = 400.0;
 
+        // BS.1770-4 overlap: 400 ms blocks with 75% overlap are formed from
+        // four consecutive 100 ms sub-blocks, one new block per 100 ms hop
+        constexpr double SUB_BLOCK_DURATION_MS = 100.0;
+        constexpr int SUB_BLOCKS_PER_BLOCK = 4;
+
         // K-offset from ITU-R BS.1770
         constexpr double K_OFFSET_DB = -0.691;
 
@@ -47,6 +85,15 @@ namespace DSPSSOT
 
         // Relative gate offset (L_int - 10 LU)
         constexpr double GATE_REL_OFFSET_DB = 10.0;
+        constexpr double GATE_REL_ENERGY_FACTOR = 0.1;  // 10^(-GATE_REL_OFFSET_DB / 10)
+
+        // Block loudness histogram for exact two-pass relative gating
+        // Fixed 0.1 LU bins from the absolute gate (-70 LUFS) to +5 LUFS:
+        // memory is constant regardless of program length
+        constexpr double HISTOGRAM_MIN_LUFS = GATE_ABS_DB;
+        constexpr double HISTOGRAM_MAX_LUFS = 5.0;
+        constexpr double HISTOGRAM_BIN_WIDTH_LU = 0.1;
+        constexpr int HISTOGRAM_NUM_BINS = 750;  // (MAX - MIN) / BIN_WIDTH
 
         // JSFX Calibration offset (empirically derived)
         // C++ measures ~1.7 dB lower than JSFX reference on identical audio
@@ -55,16 +102,78 @@ namespace DSPSSOT
         constexpr double JSFX_CALIBRATION_OFFSET_DB = 1.7;
     }
 
+    // ==========================================
+    // MOMENTARY / SHORT-TERM LOUDNESS (EBU R128)
+    // ==========================================
+    namespace LoudnessWindows
+    {
+        // Sliding windows built from the same 100 ms sub-blocks as gating
+        constexpr double MOMENTARY_DURATION_MS = 400.0;    // EBU Tech 3341 "M"
+        constexpr double SHORT_TERM_DURATION_MS = 3000.0;  // EBU Tech 3341 "S"
+
+        constexpr int MOMENTARY_SUB_BLOCKS = 4;    // MOMENTARY_DURATION_MS / SUB_BLOCK_DURATION_MS
+        constexpr int SHORT_TERM_SUB_BLOCKS = 30;  // SHORT_TERM_DURATION_MS / SUB_BLOCK_DURATION_MS
+
+        static_assert(MOMENTARY_SUB_BLOCKS == GatedIntegration::SUB_BLOCKS_PER_BLOCK,
+                      "Momentary window and gating block share the same 400 ms span");
+    }
+
+    // ==========================================
+    // LOUDNESS RANGE (EBU Tech 3342)
+    // ==========================================
+    namespace LoudnessRange
+    {
+        // Short-term values are gated at -70 LUFS (absolute) and
+        // 20 LU below their mean (relative) before percentiles are taken
+        constexpr double GATE_REL_OFFSET_DB = 20.0;
+        constexpr double GATE_REL_ENERGY_FACTOR = 0.01;  // 10^(-GATE_REL_OFFSET_DB / 10)
+
+        // LRA = P95 - P10 of the gated short-term loudness distribution
+        constexpr double LOW_PERCENTILE = 0.10;
+        constexpr double HIGH_PERCENTILE = 0.95;
+    }
+
+    // ==========================================
+    // LOUDNESS TIMELINE (history view)
+    // ==========================================
+    namespace Timeline
+    {
+        // One frame per 100 ms gating hop
+        constexpr double FRAME_DURATION_MS = GatedIntegration::SUB_BLOCK_DURATION_MS;
+
+        // Mipmap: level k buckets span 2^k frames; each level keeps the
+        // newest BUCKETS_PER_LEVEL buckets. Level 0 holds the last ~6.8 min
+        // at full resolution, the top level the last ~14.5 h (~1 MB total)
+        constexpr int NUM_LEVELS = 8;
+        constexpr int BUCKETS_PER_LEVEL = 4096;
+
+        // Visible span (zoom range)
+        constexpr double MIN_VIEW_SECONDS = 10.0;
+        constexpr double MAX_VIEW_SECONDS = 3.0 * 3600.0;
+        constexpr double DEFAULT_VIEW_SECONDS = 60.0;
+    }
+
     // ==========================================
     // TRUE PEAK DETECTION PARAMETERS
     // ==========================================
     namespace TruePeak
     {
-        // Oversampling factor
+        // Oversampling factor (maximum; polyphase FIR, ITU-R BS.1770-4 Annex 2)
         constexpr int OVERSAMPLE_FACTOR = 4;
 
-        // Interpolation points
-        constexpr int INTERP_POINTS = 3;  // t = 0.25, 0.50, 0.75
+        // Polyphase interpolator: 48 taps = 4 phases x 12 taps
+        constexpr int FIR_PHASES = 4;
+        constexpr int FIR_TAPS_PER_PHASE = 12;
+
+        // Oversampling is chosen from the sample rate so the interpolated
+        // rate stays >= 176.4 kHz: 4x below 88.2 kHz, 2x below 176.4 kHz,
+        // sample peak (1x) at 176.4 kHz and above
+        constexpr double OVERSAMPLE_2X_MIN_RATE = 88200.0;
+        constexpr double OVERSAMPLE_1X_MIN_RATE = 176400.0;
+
+        // Early-out run length: the interpolator is skipped for a run of
+        // input samples when no output in it can exceed the running peak
+        constexpr int EARLY_OUT_RUN = 8;
 
         // Display range
         constexpr double MIN_DISPLAY_DB = -120.0;
@@ -119,12 +228,67 @@ namespace DSPSSOT
             return std::pow(10.0, db / 20.0);
         }
 
+        // Mean-square K-weighted energy to displayed loudness
+        // (K-offset + JSFX calibration, clamped to the display range)
+        inline double energyToDisplayLUFS(double meanEnergy)
+        {
+            // EDGE CASE: NaN, silence and denormal energy read as the display floor
+            if (std::isnan(meanEnergy) || meanEnergy <= TruePeak::DENORM_THRESHOLD)
+                return TruePeak::MIN_DISPLAY_DB;
+
+            const double lufs = GatedIntegration::K_OFFSET_DB + 10.0 * std::log10(meanEnergy)
+                              + GatedIntegration::JSFX_CALIBRATION_OFFSET_DB;
+            return std::fmin(std::fmax(lufs, TruePeak::MIN_DISPLAY_DB), TruePeak::MAX_DISPLAY_DB);
+        }
+
+        // Linear True Peak to displayed dBTP (clamped to the display range)
+        inline double truePeakToDisplayDB(double peak)
+        {
+            // EDGE CASE: NaN, infinity, silence and denormal peaks read as the display floor
+            if (std::isnan(peak) || std::isinf(peak) || peak <= TruePeak::DENORM_THRESHOLD)
+                return TruePeak::MIN_DISPLAY_DB;
+
+            const double db = 20.0 * std::log10(peak);
+            return std::fmin(std::fmax(db, TruePeak::MIN_DISPLAY_DB), TruePeak::MAX_DISPLAY_DB);
+        }
+
+        // True Peak oversampling factor for a sample rate (4, 2 or 1)
+        constexpr int truePeakOversamplingFactor(double sampleRate)
+        {
+            return (sampleRate < TruePeak::OVERSAMPLE_2X_MIN_RATE) ? 4
+                 : (sampleRate < TruePeak::OVERSAMPLE_1X_MIN_RATE) ? 2
+                 : 1;
+        }
+
         // Calculate block size from sample rate
         constexpr int calculateBlockSize(double sampleRate)
         {
             return static_cast<int>((GatedIntegration::BLOCK_DURATION_MS / 1000.0) * sampleRate);
         }
 
+        // Calculate 100 ms sub-block (gating hop) size from sample rate
+        constexpr int calculateSubBlockSize(double sampleRate)
+        {
+            return static_cast<int>((GatedIntegration::SUB_BLOCK_DURATION_MS / 1000.0) * sampleRate);
+        }
+
+        // Halfband decimation factor of the high-rate loudness path (1 = native rate)
+        // Halves while the output stays >= 44.1 kHz and a 100 ms hop is a whole
+        // number of output frames
+        constexpr int highRateDecimationFactor(double sampleRate)
+        {
+            if (sampleRate < HighRate::MIN_DECIMATION_RATE)
+                return 1;
+
+            const int hop = calculateSubBlockSize(sampleRate);
+            int factor = 1;
+            while (2 * factor <= HighRate::MAX_DECIMATION_FACTOR &&
+                   sampleRate / (2 * factor) >= HighRate::MIN_OUTPUT_RATE &&
+                   hop % (2 * factor) == 0)
+                factor *= 2;
+            return factor;
+        }
+
         // Get K-weighting high-pass coefficients
         // Returns array: [b0, b1, b2, a1, a2] normalized by a0
         inline void calculateHighPassCoeffs(double fc, double Q, double srate, double* coeffs)
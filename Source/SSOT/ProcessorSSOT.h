@@ -9,6 +9,31 @@ namespace ProcessorSSOT
     {
         constexpr int MAX_BUFFER_SIZE = 8192;
         constexpr int MIN_BUFFER_SIZE = 64;
+
+        // Block processing segment size (stack-free scratch inside the DSP core)
+        constexpr int PROCESS_CHUNK_SIZE = 256;
+    }
+
+    // ==========================================
+    // LOUDNESS HISTORY STREAM
+    // ==========================================
+    namespace History
+    {
+        // One record per 100 ms gating hop
+        constexpr int HOPS_PER_SECOND = 10;
+
+        // Records kept while nobody drains the stream (editor closed). Each
+        // instance allocates the configured capacity in prepareToPlay (32 bytes
+        // per record): 10 minutes = 6000 records, ~190 KB by default; the
+        // 6 h ceiling (216000 records, ~7 MB) only when a user asks for it
+        constexpr double DEFAULT_CAPACITY_SECONDS = 600.0;
+        constexpr double MAX_CAPACITY_SECONDS = 6.0 * 3600.0;
+
+        constexpr int capacityForSeconds(double seconds)
+        {
+            return (seconds <= 0.0) ? 0
+                 : static_cast<int>((seconds < MAX_CAPACITY_SECONDS ? seconds : MAX_CAPACITY_SECONDS) * HOPS_PER_SECOND);
+        }
     }
 
     // ==========================================
@@ -27,15 +52,15 @@ namespace ProcessorSSOT
     // ==========================================
     namespace Channels
     {
-        constexpr int MAX_INPUT_CHANNELS = 2;
-        constexpr int MAX_OUTPUT_CHANNELS = 2;
+        constexpr int MAX_INPUT_CHANNELS = 12;   // 7.1.4
+        constexpr int MAX_OUTPUT_CHANNELS = 12;
         constexpr int DEFAULT_INPUT_CHANNELS = 2;
         constexpr int DEFAULT_OUTPUT_CHANNELS = 2;
 
         // Supported configurations
         constexpr bool SUPPORTS_STEREO = true;
         constexpr bool SUPPORTS_MONO = true;
-        constexpr bool SUPPORTS_SURROUND = false;
+        constexpr bool SUPPORTS_SURROUND = true;  // 5.1, 7.1, 7.1.4 (one gated integrator)
     }
 
     // ==========================================
@@ -48,6 +73,10 @@ namespace ProcessorSSOT
         constexpr double DEFAULT_SAMPLE_RATE = 48000.0;
         constexpr double SUPPORTED_RATES[] = {44100.0, 48000.0, 88200.0, 96000.0, 176400.0, 192000.0};
         constexpr int SUPPORTED_RATE_COUNT = 6;
+
+        // Rates the DSP core accepts at all (setSampleRate ignores others)
+        constexpr double MIN_VALID_SAMPLE_RATE = 8000.0;
+        constexpr double MAX_VALID_SAMPLE_RATE = 1000000.0;  // 1 MHz
     }
 
     // ==========================================
@@ -99,17 +128,18 @@ namespace ProcessorSSOT
     // ==========================================
     namespace Performance
     {
-        // Expected CPU usage (per channel, at 48kHz)
-        // Based on optimized implementation with cached coefficients
-        constexpr double CPU_PERCENT_PER_CHANNEL = 0.08;  // ~0.08% per channel
+        // CPU usage is machine-dependent and not a constant: BULLsEYEBenchmarks
+        // reports it per case (cpu_pct = real-time CPU % of one core)
 
         // True Peak atomic batching
         constexpr int TRUE_PEAK_BATCH_SIZE = 100;  // Update atomic every N samples
 
         // DSP operations per sample (optimized count)
         constexpr int OPS_PER_SAMPLE_KWEIGHTING = 18;    // 2 biquads = 10 mults + 8 adds
+        constexpr int KWEIGHTING_SIMD_LANES = 2;          // L/R share one double vector (SSE2/NEON)
         constexpr int OPS_PER_SAMPLE_ENERGY = 5;          // 2 mults + 2 adds + 1 comparison
-        constexpr int OPS_PER_SAMPLE_TRUE_PEAK = 120;     // 4 interp * 8 mults + 4 abs + 4 max + overhead
+        constexpr int OPS_PER_SAMPLE_TRUE_PEAK = 104;     // 4x FIR: 4 phases * 12 taps * (mult + add) + 4 abs + 4 max
+                                                          // (2x at 88.2/96k: 52, 1x at 176.4k+: 2)
 
         // Estimated total operations per stereo sample
         constexpr int OPS_PER_STEREO_SAMPLE = (OPS_PER_SAMPLE_KWEIGHTING * 2) +
@@ -120,7 +150,20 @@ namespace ProcessorSSOT
         constexpr size_t STATE_SIZE_BYTES = sizeof(double) * 24;  // Filter states + buffers
         constexpr size_t CACHE_LINE_PADDING = 64;  // L1 cache line size
 
-        // Worst-case CPU at 192kHz stereo (estimated)
-        constexpr double MAX_CPU_PERCENT_AT_192KHZ = 0.35;
+        // Benchmark regression gate (BULLsEYEBenchmarks --baseline):
+        // fail when ns/sample exceeds the stored baseline by more than this
+        constexpr double BENCHMARK_MAX_REGRESSION_PERCENT = 10.0;
+    }
+
+    // ==========================================
+    // AUDIO-THREAD TIMING (BULLSEYE_ENABLE_TIMING builds)
+    // ==========================================
+    namespace Timing
+    {
+        // Log-bucket histogram: 2^3 = 8 buckets per octave (<= 12.5% bucket width)
+        constexpr int HISTOGRAM_SUB_BUCKET_BITS = 3;
+
+        // Budget utilisation is histogrammed in parts per million of the buffer length
+        constexpr double UTILISATION_PPM = 1e6;
     }
 }
@@ -43,6 +43,11 @@ namespace UISSOT
         inline juce::Colour ledRed() { return juce::Colour(0xffff0000); }             // Danger zone
         inline juce::Colour ledTargetMarker() { return juce::Colour(0xff00ffff); }     // Cyan target line
 
+        // Loudness timeline colors
+        inline juce::Colour timelineRange() { return juce::Colour(0x664a9eff); }       // Momentary min/max band
+        inline juce::Colour timelineMean() { return juce::Colour(0xffffffff); }        // Mean loudness line
+        inline juce::Colour timelineGrid() { return juce::Colour(0xff2a2a2a); }
+
         // Error state colors
         inline juce::Colour errorState() { return juce::Colour(0xffff00ff); }           // Yellow for invalid/error states
         inline juce::Colour overflow() { return juce::Colour(0xffff8800); }             // Orange for overflow/clipping
@@ -54,7 +59,9 @@ namespace UISSOT
     // ==========================================
     namespace Dimensions
     {
-        constexpr int DEFAULT_WINDOW_WIDTH = 320;
+        constexpr int METER_COLUMN_WIDTH = 320;
+        constexpr int TIMELINE_WIDTH = 320;  // Loudness timeline next to the meters
+        constexpr int DEFAULT_WINDOW_WIDTH = METER_COLUMN_WIDTH + TIMELINE_WIDTH;
         constexpr int DEFAULT_WINDOW_HEIGHT = 300;
 
         // Margins and padding
@@ -93,6 +100,12 @@ namespace UISSOT
         constexpr int LED_VALUE_WIDTH = 100;
         constexpr int LED_VALUE_HEIGHT = 20;
 
+        // Loudness timeline
+        constexpr double TIMELINE_MIN_LUFS = -48.0;   // Bottom of the loudness axis
+        constexpr double TIMELINE_MAX_LUFS = 0.0;     // Top of the loudness axis
+        constexpr double TIMELINE_GRID_STEP_LU = 6.0;
+        constexpr double TIMELINE_ZOOM_STEP = 1.25;   // View span factor per wheel notch
+
         // Edge case and validation thresholds
         constexpr double MIN_VALID_SAMPLE_RATE = 8000.0;    // Minimum valid sample rate
         constexpr double MAX_VALID_SAMPLE_RATE = 1000000.0; // Maximum valid sample rate (1 MHz)
@@ -111,6 +124,10 @@ namespace UISSOT
         inline juce::String lufsLabel() { return "Live LUFS-I"; }
         inline juce::String mixEnergyLabel() { return "Mix Energy"; }
         inline juce::String truePeakLabel() { return "True Peak"; }
+        inline juce::String momentaryLabel() { return "M"; }
+        inline juce::String shortTermLabel() { return "S"; }
+        inline juce::String loudnessRangeLabel() { return "LRA"; }
+        inline juce::String timelineLabel() { return "History"; }
         inline juce::String statusBalanced() { return "Balanced"; }
         inline juce::String statusHot() { return "Hot"; }
         inline juce::String statusQuiet() { return "Quiet"; }
@@ -152,5 +169,6 @@ namespace UISSOT
     {
         constexpr int UI_REFRESH_RATE_HZ = 30;
         constexpr int METER_SMOOTHING_MS = 100;
+        constexpr int DIAGNOSTICS_REFRESH_RATE_HZ = 2;   // Callback timing overlay (BULLSEYE_ENABLE_TIMING)
     }
 }
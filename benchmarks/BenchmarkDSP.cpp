@@ -0,0 +1,512 @@
+/**
+ * @file BenchmarkDSP.cpp
+ * @brief Google Benchmark cases for the DSP hot paths
+ *
+ * Every case reports two counters:
+ * - ns_per_sample: wall time per sample frame (all channels)
+ * - cpu_pct: implied real-time CPU load, time / audio duration * 100
+ *
+ * Cases run at 44.1 / 48 / 88.2 / 96 / 176.4 / 192 kHz, stereo (the
+ * precision policy cases also with 12 channels). Precision policy and
+ * feature set cases instantiate the core template directly.
+ *
+ * @note Benchmarks are designed to run without JUCE dependencies
+ */
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+#include "DSP/BULLsEYEProcessor.h"
+#include "DSP/KWeightingBlockFilter.h"
+#include "DSP/KWeightingFilter.h"
+#include "DSP/FeaturePolicy.h"
+#include "DSP/LoudnessHistogram.h"
+#include "DSP/PrecisionPolicy.h"
+#include "DSP/TruePeakDetector.h"
+#include "SSOT/DSPSSOT.h"
+#include "SSOT/ProcessorSSOT.h"
+
+// ========================================================================
+// HELPERS
+// ========================================================================
+
+namespace
+{
+    constexpr int CHUNK = 512;   // frames per iteration for the fixed-size cases
+
+    // Music-like test signal: two partials, -12 dBFS, slightly different per channel
+    std::vector<float> makeSignal(double sampleRate, int numFrames, double phase)
+    {
+        std::vector<float> signal(static_cast<size_t>(numFrames));
+        for (int i = 0; i < numFrames; ++i)
+        {
+            const double t = i / sampleRate;
+            signal[static_cast<size_t>(i)] = static_cast<float>(
+                0.2 * std::sin(DSPSSOT::Math::TAU * 220.0 * t + phase)
+              + 0.05 * std::sin(DSPSSOT::Math::TAU * 3150.0 * t + 2.0 * phase));
+        }
+        return signal;
+    }
+
+    /**
+     * Wall time of one benchmark run (the timed loop), for the per-sample counters
+     */
+    class RunTimer
+    {
+    public:
+        RunTimer() : start(std::chrono::steady_clock::now()) {}
+
+        double elapsedNs() const
+        {
+            return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        }
+
+    private:
+        std::chrono::steady_clock::time_point start;
+    };
+
+    void setCounters(benchmark::State& state, const RunTimer& timer, double sampleRate, std::int64_t framesPerIteration)
+    {
+        const double elapsedNs = timer.elapsedNs();
+        const double frames = static_cast<double>(state.iterations() * framesPerIteration);
+        if (frames <= 0.0)
+            return;
+
+        const double nsPerSample = elapsedNs / frames;
+        state.counters["ns_per_sample"] = nsPerSample;
+        state.counters["cpu_pct"] = nsPerSample * sampleRate * 1e-9 * 100.0;   // time / audio duration
+        state.SetItemsProcessed(state.iterations() * framesPerIteration);
+    }
+
+    void sampleRates(benchmark::internal::Benchmark* b)
+    {
+        for (const int rate : {44100, 48000, 88200, 96000, 176400, 192000})
+            b->Arg(rate);
+    }
+
+    void sampleRatesAndBufferSizes(benchmark::internal::Benchmark* b)
+    {
+        for (const int rate : {44100, 48000, 88200, 96000, 176400, 192000})
+            for (int buffer = 32; buffer <= 8192; buffer *= 4)
+                b->Args({rate, buffer});
+    }
+}
+
+// ========================================================================
+// FULL CORE
+// ========================================================================
+
+/**
+ * process() per stereo sample (per-sample path, TP published in batches)
+ */
+static void BM_ProcessPerSample(benchmark::State& state)
+{
+    const double rate = static_cast<double>(state.range(0));
+    const std::vector<float> left = makeSignal(rate, CHUNK, 0.0);
+    const std::vector<float> right = makeSignal(rate, CHUNK, 0.5);
+
+    auto core = std::make_unique<BULLsEYEProcessorCore>();
+    core->setSampleRate(rate);
+
+    const RunTimer timer;
+    for (auto _ : state)
+    {
+        for (int i = 0; i < CHUNK; ++i)
+        {
+            float l = left[static_cast<size_t>(i)];
+            float r = right[static_cast<size_t>(i)];
+            core->process(l, r);
+        }
+        benchmark::ClobberMemory();
+    }
+
+    setCounters(state, timer, rate, CHUNK);
+}
+BENCHMARK(BM_ProcessPerSample)->Apply(sampleRates);
+
+/**
+ * processBlock() at host buffer sizes 32 - 8192 (one publication per block)
+ */
+static void BM_ProcessBlock(benchmark::State& state)
+{
+    const double rate = static_cast<double>(state.range(0));
+    const int bufferSize = static_cast<int>(state.range(1));
+    const std::vector<float> left = makeSignal(rate, bufferSize, 0.0);
+    const std::vector<float> right = makeSignal(rate, bufferSize, 0.5);
+    const float* channels[2] = {left.data(), right.data()};
+
+    auto core = std::make_unique<BULLsEYEProcessorCore>();
+    core->setSampleRate(rate);
+
+    const RunTimer timer;
+    for (auto _ : state)
+    {
+        core->processBlock(channels, 2, bufferSize);
+        benchmark::ClobberMemory();
+    }
+
+    setCounters(state, timer, rate, bufferSize);
+}
+BENCHMARK(BM_ProcessBlock)->Apply(sampleRatesAndBufferSizes);
+
+/**
+ * processBlock() per precision policy and feature set, 512-frame buffers,
+ * stereo and 7.1.4 (accuracy of each policy: TestPrecisionPolicy)
+ */
+template<typename Policy, typename FeatureSet = Features::All>
+static void BM_ProcessBlockPrecision(benchmark::State& state)
+{
+    const double rate = static_cast<double>(state.range(0));
+    const int numChannels = static_cast<int>(state.range(1));
+
+    std::vector<std::vector<float>> signals;
+    std::vector<const float*> channels;
+    for (int ch = 0; ch < numChannels; ++ch)
+        signals.push_back(makeSignal(rate, CHUNK, 0.5 * ch));
+    for (const auto& signal : signals)
+        channels.push_back(signal.data());
+
+    auto core = std::make_unique<BasicBULLsEYEProcessorCore<Policy, FeatureSet>>();
+    core->setSampleRate(rate);
+
+    const RunTimer timer;
+    for (auto _ : state)
+    {
+        core->processBlock(channels.data(), numChannels, CHUNK);
+        benchmark::ClobberMemory();
+    }
+
+    setCounters(state, timer, rate, CHUNK);
+}
+
+static void precisionCases(benchmark::internal::Benchmark* b)
+{
+    for (const int rate : {48000, 192000})
+        for (const int numChannels : {2, ProcessorSSOT::Channels::MAX_INPUT_CHANNELS})
+            b->Args({rate, numChannels});
+}
+BENCHMARK_TEMPLATE(BM_ProcessBlockPrecision, Precision::Double)->Apply(precisionCases);
+BENCHMARK_TEMPLATE(BM_ProcessBlockPrecision, Precision::FloatFilter)->Apply(precisionCases);
+BENCHMARK_TEMPLATE(BM_ProcessBlockPrecision, Precision::Float)->Apply(precisionCases);
+
+// LUFS-I only: the filter and energy stages the policy changes, without the
+// (always double) True Peak stage that dominates the full set
+BENCHMARK_TEMPLATE(BM_ProcessBlockPrecision, Precision::Double, Features::IntegratedOnly)->Apply(precisionCases);
+BENCHMARK_TEMPLATE(BM_ProcessBlockPrecision, Precision::FloatFilter, Features::IntegratedOnly)->Apply(precisionCases);
+BENCHMARK_TEMPLATE(BM_ProcessBlockPrecision, Precision::Float, Features::IntegratedOnly)->Apply(precisionCases);
+
+/**
+ * processBlock() per feature set, stereo 512-frame buffers
+ * (LUFS-I only and True Peak only against the full plugin set)
+ */
+template<typename FeatureSet>
+static void BM_ProcessBlockFeatures(benchmark::State& state)
+{
+    const double rate = static_cast<double>(state.range(0));
+    const std::vector<float> left = makeSignal(rate, CHUNK, 0.0);
+    const std::vector<float> right = makeSignal(rate, CHUNK, 0.5);
+    const float* channels[2] = {left.data(), right.data()};
+
+    auto core = std::make_unique<BasicBULLsEYEProcessorCore<Precision::Double, FeatureSet>>();
+    core->setSampleRate(rate);
+
+    const RunTimer timer;
+    for (auto _ : state)
+    {
+        core->processBlock(channels, 2, CHUNK);
+        benchmark::ClobberMemory();
+    }
+
+    setCounters(state, timer, rate, CHUNK);
+}
+BENCHMARK_TEMPLATE(BM_ProcessBlockFeatures, Features::All)->Apply(sampleRates);
+BENCHMARK_TEMPLATE(BM_ProcessBlockFeatures, Features::Analyzer)->Apply(sampleRates);
+BENCHMARK_TEMPLATE(BM_ProcessBlockFeatures, Features::IntegratedOnly)->Apply(sampleRates);
+BENCHMARK_TEMPLATE(BM_ProcessBlockFeatures, Features::TruePeakOnly)->Apply(sampleRates);
+
+/**
+ * processBlock() on digital silence after programme material, stereo
+ * 512-frame buffers (idle track: filter and True Peak skipped once settled)
+ */
+static void BM_ProcessBlockSilence(benchmark::State& state)
+{
+    const double rate = static_cast<double>(state.range(0));
+    const std::vector<float> left = makeSignal(rate, CHUNK, 0.0);
+    const std::vector<float> right = makeSignal(rate, CHUNK, 0.5);
+    const std::vector<float> silence(CHUNK, 0.0f);
+    const float* programme[2] = {left.data(), right.data()};
+    const float* channels[2] = {silence.data(), silence.data()};
+
+    auto core = std::make_unique<BULLsEYEProcessorCore>();
+    core->setSampleRate(rate);
+    core->processBlock(programme, 2, CHUNK);
+    for (int i = 0; i < static_cast<int>(rate) / CHUNK; ++i)   // 1 s of silence to settle
+        core->processBlock(channels, 2, CHUNK);
+
+    const RunTimer timer;
+    for (auto _ : state)
+    {
+        core->processBlock(channels, 2, CHUNK);
+        benchmark::ClobberMemory();
+    }
+
+    setCounters(state, timer, rate, CHUNK);
+}
+BENCHMARK(BM_ProcessBlockSilence)->Apply(sampleRates);
+
+/**
+ * processBlock() on material below a peak set earlier (a full-scale click,
+ * then the test signal), stereo 512-frame buffers, history stream on
+ * (window True Peak taken every hop). tp_interpolated_pct: share of input
+ * samples the True Peak early out did not skip.
+ */
+static void BM_ProcessBlockBelowPeak(benchmark::State& state)
+{
+    const double rate = static_cast<double>(state.range(0));
+    const std::vector<float> left = makeSignal(rate, CHUNK, 0.0);
+    const std::vector<float> right = makeSignal(rate, CHUNK, 0.5);
+    std::vector<float> click(CHUNK, 0.0f);
+    click[CHUNK / 2] = 1.0f;
+    const float* channels[2] = {left.data(), right.data()};
+
+    auto core = std::make_unique<BULLsEYEProcessorCore>();
+    core->setSampleRate(rate);
+    core->setHistoryCapacity(ProcessorSSOT::History::capacityForSeconds(ProcessorSSOT::History::DEFAULT_CAPACITY_SECONDS));
+    core->processBlock(click.data(), click.data(), CHUNK);
+    const long long interpolatedBefore = core->getTruePeakInterpolatedSamples();
+
+    const RunTimer timer;
+    for (auto _ : state)
+    {
+        core->processBlock(channels, 2, CHUNK);
+        core->drainHistory([](const LoudnessHopRecord&) {});
+        benchmark::ClobberMemory();
+    }
+
+    setCounters(state, timer, rate, CHUNK);
+    const double samples = 2.0 * static_cast<double>(state.iterations() * CHUNK);
+    state.counters["tp_interpolated_pct"] =
+        100.0 * static_cast<double>(core->getTruePeakInterpolatedSamples() - interpolatedBefore) / samples;
+}
+BENCHMARK(BM_ProcessBlockBelowPeak)->Apply(sampleRates);
+
+/**
+ * processBlock() at high sample rates, stereo 512-frame buffers,
+ * native-rate loudness path vs halfband decimation to 44.1 / 48 kHz
+ */
+template<bool Decimate>
+static void BM_ProcessBlockHighRate(benchmark::State& state)
+{
+    const double rate = static_cast<double>(state.range(0));
+    const std::vector<float> left = makeSignal(rate, CHUNK, 0.0);
+    const std::vector<float> right = makeSignal(rate, CHUNK, 0.5);
+    const float* channels[2] = {left.data(), right.data()};
+
+    auto core = std::make_unique<BULLsEYEProcessorCore>();
+    core->setSampleRate(rate);
+    core->setHighRateDecimation(Decimate);
+
+    const RunTimer timer;
+    for (auto _ : state)
+    {
+        core->processBlock(channels, 2, CHUNK);
+        benchmark::ClobberMemory();
+    }
+
+    setCounters(state, timer, rate, CHUNK);
+}
+BENCHMARK_TEMPLATE(BM_ProcessBlockHighRate, false)->Arg(176400)->Arg(192000)->Arg(384000);
+BENCHMARK_TEMPLATE(BM_ProcessBlockHighRate, true)->Arg(176400)->Arg(192000)->Arg(384000);
+
+// ========================================================================
+// STAGES
+// ========================================================================
+
+/**
+ * K-weighting alone (stereo in one SIMD lane group)
+ * The input is copied in each iteration so the signal never decays to denormals
+ */
+static void BM_KWeighting(benchmark::State& state)
+{
+    const double rate = static_cast<double>(state.range(0));
+    constexpr int stride = SIMD::roundUpToLanes(2);
+
+    const std::vector<float> left = makeSignal(rate, CHUNK, 0.0);
+    const std::vector<float> right = makeSignal(rate, CHUNK, 0.5);
+    std::vector<double> source(static_cast<size_t>(CHUNK * stride), 0.0);
+    for (int i = 0; i < CHUNK; ++i)
+    {
+        source[static_cast<size_t>(i * stride)] = left[static_cast<size_t>(i)];
+        source[static_cast<size_t>(i * stride + 1)] = right[static_cast<size_t>(i)];
+    }
+    SIMD::AlignedVector<double> frames(source.size());
+
+    double hp[5], hs[5];
+    DSPSSOT::Helpers::calculateHighPassCoeffs(DSPSSOT::KWeighting::HIGH_PASS_FC, DSPSSOT::KWeighting::HIGH_PASS_Q,
+                                              rate, hp);
+    DSPSSOT::Helpers::calculateHighShelfCoeffs(DSPSSOT::KWeighting::HIGH_SHELF_FC, DSPSSOT::KWeighting::HIGH_SHELF_Q,
+                                               DSPSSOT::KWeighting::HIGH_SHELF_GAIN_DB, rate, hs);
+
+    auto bank = std::make_unique<KWeightingBank<2>>();
+    bank->setCoefficients(hp, hs);
+    bank->reset();
+
+    const RunTimer timer;
+    for (auto _ : state)
+    {
+        std::memcpy(frames.data(), source.data(), source.size() * sizeof(double));
+        bank->processFrames(frames.data(), stride, CHUNK);
+        benchmark::DoNotOptimize(frames.data());
+        benchmark::ClobberMemory();
+    }
+
+    setCounters(state, timer, rate, CHUNK);
+}
+BENCHMARK(BM_KWeighting)->Apply(sampleRates);
+
+/**
+ * K-weighting of a mono or stereo stream: lane-packed bank (false) vs
+ * block-parallel state-space filter (true), 8 samples per step
+ * Args: sample rate, channel count
+ */
+template<bool BlockParallel>
+static void BM_KWeightingStream(benchmark::State& state)
+{
+    const double rate = static_cast<double>(state.range(0));
+    const int numChannels = static_cast<int>(state.range(1));
+    constexpr int stride = SIMD::roundUpToLanes(2);
+
+    std::vector<double> source(static_cast<size_t>(CHUNK * stride), 0.0);
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        const std::vector<float> signal = makeSignal(rate, CHUNK, 0.5 * ch);
+        for (int i = 0; i < CHUNK; ++i)
+            source[static_cast<size_t>(i * stride + ch)] = signal[static_cast<size_t>(i)];
+    }
+    SIMD::AlignedVector<double> frames(source.size());
+
+    double hp[5], hs[5];
+    DSPSSOT::Helpers::calculateHighPassCoeffs(DSPSSOT::KWeighting::HIGH_PASS_FC, DSPSSOT::KWeighting::HIGH_PASS_Q,
+                                              rate, hp);
+    DSPSSOT::Helpers::calculateHighShelfCoeffs(DSPSSOT::KWeighting::HIGH_SHELF_FC, DSPSSOT::KWeighting::HIGH_SHELF_Q,
+                                               DSPSSOT::KWeighting::HIGH_SHELF_GAIN_DB, rate, hs);
+
+    auto bank = std::make_unique<KWeightingBank<2>>();
+    auto blockFilter = std::make_unique<KWeightingBlockFilter<2>>();
+    bank->setCoefficients(hp, hs);
+    blockFilter->setCoefficients(hp, hs);
+
+    const RunTimer timer;
+    for (auto _ : state)
+    {
+        std::memcpy(frames.data(), source.data(), source.size() * sizeof(double));
+        if constexpr (BlockParallel)
+            blockFilter->processFrames(frames.data(), stride, numChannels, CHUNK);
+        else
+            bank->processFrames(frames.data(), stride, CHUNK);
+        benchmark::DoNotOptimize(frames.data());
+        benchmark::ClobberMemory();
+    }
+
+    setCounters(state, timer, rate, CHUNK);
+}
+BENCHMARK_TEMPLATE(BM_KWeightingStream, false)->Args({48000, 1})->Args({48000, 2})->Args({192000, 1});
+BENCHMARK_TEMPLATE(BM_KWeightingStream, true)->Args({48000, 1})->Args({48000, 2})->Args({192000, 1});
+
+/**
+ * True Peak alone (polyphase FIR at the rate's oversampling factor, 2 channels)
+ */
+static void BM_TruePeak(benchmark::State& state)
+{
+    const double rate = static_cast<double>(state.range(0));
+    const std::vector<float> left = makeSignal(rate, CHUNK, 0.0);
+    const std::vector<float> right = makeSignal(rate, CHUNK, 0.5);
+
+    auto detector = std::make_unique<TruePeakDetector<2>>();
+    detector->setOversamplingFactor(DSPSSOT::Helpers::truePeakOversamplingFactor(rate));
+
+    const RunTimer timer;
+    for (auto _ : state)
+    {
+        detector->process(0, left.data(), CHUNK);
+        detector->process(1, right.data(), CHUNK);
+        benchmark::DoNotOptimize(detector->getPeak());
+    }
+
+    setCounters(state, timer, rate, CHUNK);
+}
+BENCHMARK(BM_TruePeak)->Apply(sampleRates);
+
+/**
+ * True Peak on material below a peak set earlier (a full-scale click, then
+ * the -12 dBFS test signal), with and without the early out. BM_TruePeak is
+ * the case the early out cannot skip (the signal sets its own peak).
+ */
+template<bool EarlyOut>
+static void BM_TruePeakBelowPeak(benchmark::State& state)
+{
+    const double rate = static_cast<double>(state.range(0));
+    const std::vector<float> left = makeSignal(rate, CHUNK, 0.0);
+    const std::vector<float> right = makeSignal(rate, CHUNK, 0.5);
+    std::vector<float> click(CHUNK, 0.0f);
+    click[CHUNK / 2] = 1.0f;
+
+    auto detector = std::make_unique<TruePeakDetector<2, EarlyOut>>();
+    detector->setOversamplingFactor(DSPSSOT::Helpers::truePeakOversamplingFactor(rate));
+    detector->process(0, click.data(), CHUNK);
+    detector->process(1, click.data(), CHUNK);
+
+    const RunTimer timer;
+    for (auto _ : state)
+    {
+        detector->process(0, left.data(), CHUNK);
+        detector->process(1, right.data(), CHUNK);
+        benchmark::DoNotOptimize(detector->getPeak());
+    }
+
+    setCounters(state, timer, rate, CHUNK);
+}
+BENCHMARK_TEMPLATE(BM_TruePeakBelowPeak, false)->Apply(sampleRates);
+BENCHMARK_TEMPLATE(BM_TruePeakBelowPeak, true)->Apply(sampleRates);
+
+/**
+ * Gating alone: one block per 100 ms hop into the histogram, two-pass gated
+ * mean and gate check, as completeGatingBlock() does. Reported per sample of
+ * the hop it covers, so it is comparable with the other stages.
+ */
+static void BM_Gating(benchmark::State& state)
+{
+    const double rate = static_cast<double>(state.range(0));
+    const int hopFrames = DSPSSOT::Helpers::calculateSubBlockSize(rate);
+
+    // A spread of block energies around -23 LUFS, cycled
+    constexpr int NUM_BLOCKS = 1024;
+    std::vector<double> blocks(NUM_BLOCKS);
+    for (int i = 0; i < NUM_BLOCKS; ++i)
+    {
+        const double lufs = -23.0 + 12.0 * std::sin(0.37 * i);
+        blocks[static_cast<size_t>(i)] = std::pow(10.0, (lufs - DSPSSOT::GatedIntegration::K_OFFSET_DB) / 10.0);
+    }
+
+    auto histogram = std::make_unique<LoudnessHistogram>();
+    int next = 0;
+
+    const RunTimer timer;
+    for (auto _ : state)
+    {
+        const double energy = blocks[static_cast<size_t>(next)];
+        next = (next + 1) % NUM_BLOCKS;
+
+        histogram->add(energy);
+        const LoudnessHistogram::Gated gated = histogram->gatedMean(DSPSSOT::GatedIntegration::GATE_REL_ENERGY_FACTOR);
+        benchmark::DoNotOptimize(gated);
+        benchmark::DoNotOptimize(histogram->passesGates(energy, DSPSSOT::GatedIntegration::GATE_REL_ENERGY_FACTOR));
+    }
+
+    setCounters(state, timer, rate, hopFrames);
+}
+BENCHMARK(BM_Gating)->Apply(sampleRates);
@@ -0,0 +1,193 @@
+/**
+ * @file BenchmarkMain.cpp
+ * @brief Benchmark runner with a baseline regression gate
+ *
+ * Accepts every Google Benchmark flag plus:
+ *   --baseline=FILE         compare ns_per_sample with a stored run
+ *   --max-regression=PCT    allowed slowdown per case (default
+ *                           ProcessorSSOT::Performance::BENCHMARK_MAX_REGRESSION_PERCENT)
+ *
+ * A baseline is the JSON Google Benchmark writes itself:
+ *   BULLsEYEBenchmarks --benchmark_out=baseline.json --benchmark_out_format=json
+ *
+ * Exit code 1 if any case present in both runs is slower than the baseline
+ * by more than the allowed percentage.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "SSOT/ProcessorSSOT.h"
+
+#if defined(_WIN32)
+    #include <io.h>
+    #define isatty _isatty
+    #define fileno _fileno
+#else
+    #include <unistd.h>
+#endif
+
+// ========================================================================
+// HELPERS
+// ========================================================================
+
+namespace
+{
+    using Results = std::map<std::string, double>;   // case name -> ns per sample
+
+    constexpr const char* COUNTER = "ns_per_sample";
+
+    /**
+     * Console output as usual, and keep each case's ns_per_sample
+     */
+    class CapturingReporter : public benchmark::ConsoleReporter
+    {
+    public:
+        // Colour only on a terminal (CI logs stay plain)
+        CapturingReporter() : ConsoleReporter(isatty(fileno(stdout)) ? OO_Defaults : OO_Tabular) {}
+
+        Results results;
+
+        void ReportRuns(const std::vector<Run>& runs) override
+        {
+            for (const Run& run : runs)
+            {
+                const auto counter = run.counters.find(COUNTER);
+                if (run.iterations > 0 && counter != run.counters.end())
+                    results[run.benchmark_name()] = counter->second.value;
+            }
+            ConsoleReporter::ReportRuns(runs);
+        }
+    };
+
+    /**
+     * Read a quoted JSON string starting at text[pos] == '"'
+     */
+    std::string readString(const std::string& text, size_t& pos)
+    {
+        std::string out;
+        for (++pos; pos < text.size() && text[pos] != '"'; ++pos)
+        {
+            if (text[pos] == '\\' && pos + 1 < text.size())
+                ++pos;
+            out += text[pos];
+        }
+        ++pos;
+        return out;
+    }
+
+    /**
+     * Pull (name, ns_per_sample) pairs out of Google Benchmark JSON output
+     * Only the keys this runner needs are read; everything else is skipped
+     */
+    bool loadBaseline(const char* path, Results& baseline)
+    {
+        std::ifstream file(path);
+        if (!file)
+            return false;
+
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        const std::string text = buffer.str();
+
+        const size_t benchmarks = text.find("\"benchmarks\"");
+        if (benchmarks == std::string::npos)
+            return false;
+
+        std::string currentName;
+        for (size_t pos = text.find('"', benchmarks + 12); pos != std::string::npos; pos = text.find('"', pos))
+        {
+            const std::string key = readString(text, pos);
+            const size_t colon = text.find_first_not_of(" \t\r\n", pos);
+            if (colon == std::string::npos || text[colon] != ':')
+                continue;
+
+            pos = text.find_first_not_of(" \t\r\n", colon + 1);
+            if (pos == std::string::npos)
+                break;
+
+            if (key == "name" && text[pos] == '"')
+                currentName = readString(text, pos);
+            else if (key == COUNTER && !currentName.empty())
+                baseline[currentName] = std::strtod(text.c_str() + pos, nullptr);
+        }
+        return true;
+    }
+
+    /**
+     * Print the comparison; returns the number of regressions
+     */
+    int compare(const Results& baseline, const Results& current, double maxRegressionPercent)
+    {
+        int regressions = 0;
+        int compared = 0;
+
+        std::printf("\n%-44s %12s %12s %9s\n", "Baseline comparison", "base ns/smp", "now ns/smp", "change");
+        for (const auto& [name, now] : current)
+        {
+            const auto base = baseline.find(name);
+            if (base == baseline.end() || base->second <= 0.0)
+                continue;
+
+            ++compared;
+            const double change = (now / base->second - 1.0) * 100.0;
+            const bool regressed = change > maxRegressionPercent;
+            regressions += regressed ? 1 : 0;
+            std::printf("%-44s %12.3f %12.3f %+8.1f%%%s\n", name.c_str(), base->second, now, change,
+                        regressed ? "  REGRESSION" : "");
+        }
+
+        std::printf("%d cases compared, %d slower than baseline by more than %.1f%%\n", compared, regressions,
+                    maxRegressionPercent);
+        return regressions;
+    }
+}
+
+// ========================================================================
+// MAIN
+// ========================================================================
+
+int main(int argc, char** argv)
+{
+    const char* baselinePath = nullptr;
+    double maxRegressionPercent = ProcessorSSOT::Performance::BENCHMARK_MAX_REGRESSION_PERCENT;
+
+    // Strip our flags before Google Benchmark sees (and rejects) them
+    std::vector<char*> args;
+    for (int i = 0; i < argc; ++i)
+    {
+        if (std::strncmp(argv[i], "--baseline=", 11) == 0)
+            baselinePath = argv[i] + 11;
+        else if (std::strncmp(argv[i], "--max-regression=", 17) == 0)
+            maxRegressionPercent = std::atof(argv[i] + 17);
+        else
+            args.push_back(argv[i]);
+    }
+
+    int benchmarkArgc = static_cast<int>(args.size());
+    benchmark::Initialize(&benchmarkArgc, args.data());
+    if (benchmark::ReportUnrecognizedArguments(benchmarkArgc, args.data()))
+        return 2;
+
+    Results baseline;
+    if (baselinePath != nullptr && !loadBaseline(baselinePath, baseline))
+    {
+        std::fprintf(stderr, "BULLsEYEBenchmarks: cannot read baseline %s\n", baselinePath);
+        return 2;
+    }
+
+    CapturingReporter reporter;
+    benchmark::RunSpecifiedBenchmarks(&reporter);
+    benchmark::Shutdown();
+
+    if (baselinePath == nullptr)
+        return 0;
+
+    return compare(baseline, reporter.results, maxRegressionPercent) == 0 ? 0 : 1;
+}
@@ -8,15 +8,22 @@
  * - Content type switching
  * - Normalization functions
  * - Basic passthrough behavior
+ * - Silence fast path (idle detection, exact re-entry, optional core paths)
  * 
  * @note Tests are designed to run without JUCE dependencies
  */
 
 #include <gtest/gtest.h>
 #include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+#include <algorithm>
 #include "DSP/BULLsEYEProcessor.h"
 #include "SSOT/ModelSSOT.h"
 #include "SSOT/DSPSSOT.h"
+#include "TestSignals.h"
 
 // ========================================================================
 // CONSTANTS FOR TESTING
@@ -318,6 +325,529 @@ TEST(BULLsEYEProcessorCoreTest, DeviationUpdatesWithLevelChange)
     EXPECT_NE(initialDev, newDev);
 }
 
+// ========================================================================
+// BLOCK PROCESSING TESTS
+// ========================================================================
+
+/**
+ * Build a stereo test signal with sines, silence gaps and invalid samples
+ */
+static void makeBlockTestSignal(std::vector<float>& left, std::vector<float>& right, int numSamples)
+{
+    left.resize(numSamples);
+    right.resize(numSamples);
+
+    for (int i = 0; i < numSamples; i++)
+    {
+        double t = static_cast<double>(i) / TEST_SAMPLE_RATE;
+        double gain = ((i / 30000) % 3 == 2) ? 0.0 : 0.8;  // Periodic silence gaps
+        left[i] = static_cast<float>(gain * std::sin(DSPSSOT::Math::TAU * 440.0 * t));
+        right[i] = static_cast<float>(gain * 0.5 * std::sin(DSPSSOT::Math::TAU * 3000.0 * t));
+    }
+
+    // EDGE CASE: NaN, infinity and denormal inputs
+    left[1234] = std::nanf("");
+    right[5678] = std::numeric_limits<float>::infinity();
+    left[9000] = 1e-30f;
+}
+
+TEST(BULLsEYEProcessorCoreTest, ProcessBlockIsBitIdenticalToPerSample)
+{
+    std::vector<float> left, right;
+    const int numSamples = 200000;  // Multiple of the TP batch size
+    makeBlockTestSignal(left, right, numSamples);
+
+    BULLsEYEProcessorCore perSample;
+    perSample.setSampleRate(TEST_SAMPLE_RATE);
+    for (int i = 0; i < numSamples; i++)
+    {
+        float l = left[i];
+        float r = right[i];
+        perSample.process(l, r);
+    }
+
+    // Irregular host block sizes, including 1 and sizes above the scratch size
+    const int blockSizes[] = {1, 37, 64, 511, 512, 4096, 8192};
+
+    for (int hostBlock : blockSizes)
+    {
+        BULLsEYEProcessorCore block;
+        block.setSampleRate(TEST_SAMPLE_RATE);
+
+        for (int offset = 0; offset < numSamples; offset += hostBlock)
+        {
+            int n = std::min(hostBlock, numSamples - offset);
+            block.processBlock(left.data() + offset, right.data() + offset, n);
+        }
+
+        EXPECT_EQ(block.getIntegratedLUFS(), perSample.getIntegratedLUFS()) << "host block " << hostBlock;
+        EXPECT_EQ(block.getDeviationLU(), perSample.getDeviationLU()) << "host block " << hostBlock;
+        EXPECT_EQ(block.getTruePeakDB(), perSample.getTruePeakDB()) << "host block " << hostBlock;
+        EXPECT_EQ(block.getSampleSum(), perSample.getSampleSum()) << "host block " << hostBlock;
+        EXPECT_EQ(block.getTotalSamplesProcessed(), perSample.getTotalSamplesProcessed()) << "host block " << hostBlock;
+    }
+
+    EXPECT_GT(perSample.getIntegratedLUFS(), DSPSSOT::TruePeak::MIN_DISPLAY_DB);
+}
+
+TEST(BULLsEYEProcessorCoreTest, ProcessBlockPublishesTruePeakPerHostBlock)
+{
+    BULLsEYEProcessorCore processor;
+    processor.setSampleRate(TEST_SAMPLE_RATE);
+
+    // Fewer samples than TP_BATCH_SIZE: per-sample path would not publish yet
+    const float left[10] = {0.0f, 0.5f, 0.0f, -0.5f, 0.0f, 0.5f, 0.0f, -0.5f, 0.0f, 0.5f};
+    const float right[10] = {};
+    processor.processBlock(left, right, 10);
+
+    EXPECT_GT(processor.getTruePeakDB(), -7.0);
+}
+
+TEST(BULLsEYEProcessorCoreTest, ProcessBlockAcceptsDoubleSamples)
+{
+    std::vector<double> left(48000), right(48000);
+    for (int i = 0; i < 48000; i++)
+    {
+        left[i] = 0.5 * std::sin(DSPSSOT::Math::TAU * 1000.0 * i / TEST_SAMPLE_RATE);
+        right[i] = left[i];
+    }
+
+    BULLsEYEProcessorCore processor;
+    processor.setSampleRate(TEST_SAMPLE_RATE);
+    processor.processBlock(left.data(), right.data(), 48000);
+
+    EXPECT_GT(processor.getIntegratedLUFS(), DSPSSOT::TruePeak::MIN_DISPLAY_DB);
+}
+
+// ========================================================================
+// SILENCE FAST PATH TESTS
+// ========================================================================
+
+/**
+ * Feed numSamples frames of one constant value on every channel, in 512-frame host blocks
+ */
+static void processConstantBlocks(BULLsEYEProcessorCore& processor, int numChannels, int numSamples, float value)
+{
+    const std::vector<float> buffer(512, value);
+    const float* channels[ProcessorSSOT::Channels::MAX_INPUT_CHANNELS];
+    for (int ch = 0; ch < numChannels; ch++)
+        channels[ch] = buffer.data();
+
+    for (int offset = 0; offset < numSamples; offset += 512)
+        processor.processBlock(channels, numChannels, std::min(512, numSamples - offset));
+}
+
+TEST(SilenceFastPathTest, IdleOnceHistoriesSettle)
+{
+    BULLsEYEProcessorCore processor;
+    processor.setSampleRate(TEST_SAMPLE_RATE);
+    EXPECT_TRUE(processor.isIdle());
+
+    processConstantBlocks(processor, 2, 24000, 0.5f);
+    EXPECT_FALSE(processor.isIdle());
+
+    // Filters need ~0.1 s to decay below the denormal threshold
+    processConstantBlocks(processor, 2, 512, 0.0f);
+    EXPECT_FALSE(processor.isIdle());
+    processConstantBlocks(processor, 2, 24000, 0.0f);
+    EXPECT_TRUE(processor.isIdle());
+
+    // Samples that sanitize to zero are silence
+    const float nan = std::nanf("");
+    const float denormal = 1e-30f;
+    processor.processBlock(&nan, &denormal, 1);
+    EXPECT_TRUE(processor.isIdle());
+
+    // First audible sample leaves the fast path
+    const float quiet = 1e-6f;
+    processor.processBlock(&quiet, &denormal, 1);
+    EXPECT_FALSE(processor.isIdle());
+
+    processor.reset();
+    EXPECT_TRUE(processor.isIdle());
+}
+
+TEST(SilenceFastPathTest, IdleCoreMeasuresFirstSampleExactly)
+{
+    // Quiet programme, settled silence, then a click in the middle of a host block
+    std::vector<float> click(512, 0.0f);
+    click[300] = 0.9f;
+    click[301] = -0.7f;
+
+    BULLsEYEProcessorCore idle;
+    idle.setSampleRate(TEST_SAMPLE_RATE);
+    processConstantBlocks(idle, 2, 48000, 0.05f);
+    processConstantBlocks(idle, 2, 48000, 0.0f);
+    ASSERT_TRUE(idle.isIdle());
+    idle.processBlock(click.data(), click.data(), 512);
+
+    // A fresh core has all-zero histories too: the click must read identically
+    BULLsEYEProcessorCore fresh;
+    fresh.setSampleRate(TEST_SAMPLE_RATE);
+    fresh.processBlock(click.data(), click.data(), 512);
+
+    EXPECT_EQ(idle.getTruePeakDB(), fresh.getTruePeakDB());
+    EXPECT_GT(idle.getTruePeakDB(), 20.0 * std::log10(0.9));
+    EXPECT_FALSE(idle.isIdle());
+}
+
+TEST(SilenceFastPathTest, EveryProcessedChannelMustSettle)
+{
+    BULLsEYEProcessorCore processor;
+    processor.setSampleRate(TEST_SAMPLE_RATE);
+
+    // 5.1 programme, then stereo silence: only L / R settle
+    processConstantBlocks(processor, 6, 24000, 0.5f);
+    processConstantBlocks(processor, 2, 24000, 0.0f);
+    EXPECT_TRUE(processor.isIdle());
+
+    // Back to 5.1: channels 3 - 6 still hold their filter state
+    processConstantBlocks(processor, 6, 4800, 0.0f);
+    EXPECT_FALSE(processor.isIdle());
+
+    processConstantBlocks(processor, 6, 24000, 0.0f);
+    EXPECT_TRUE(processor.isIdle());
+}
+
+/**
+ * Optional core paths (block-parallel K-weighting, high-rate decimation)
+ * settle for silence too, so idle tracks take the fast path
+ */
+struct CoreOptionCase
+{
+    const char* name;
+    double sampleRate;
+    TestSignals::CoreOptions options;
+};
+
+class SilenceFastPathOptionTest : public ::testing::TestWithParam<CoreOptionCase> {};
+
+TEST_P(SilenceFastPathOptionTest, OptionalPathSettlesForSilence)
+{
+    const CoreOptionCase& param = GetParam();
+    const int oneSecond = static_cast<int>(param.sampleRate);
+    auto core = TestSignals::makeCore(param.sampleRate, param.options);
+    TestSignals::feedBlocks(*core, TestSignals::makeTone(0.5, oneSecond, param.sampleRate, 440.0));
+    EXPECT_FALSE(core->isIdle());
+
+    const std::vector<float> silence(static_cast<size_t>(oneSecond), 0.0f);
+    for (int i = 0; i < 10 && !core->isIdle(); ++i)
+        TestSignals::feedBlocks(*core, silence);
+    EXPECT_TRUE(core->isIdle());
+}
+
+INSTANTIATE_TEST_SUITE_P(CoreOptions, SilenceFastPathOptionTest,
+    ::testing::Values(
+        CoreOptionCase{"BlockParallelKWeighting", 48000.0, TestSignals::CoreOptions::withBlockParallelKWeighting(true)},
+        CoreOptionCase{"HighRateDecimation", 192000.0, TestSignals::CoreOptions::withHighRateDecimation(true)}),
+    [](const ::testing::TestParamInfo<CoreOptionCase>& info) { return std::string(info.param.name); });
+
+// ========================================================================
+// K-WEIGHTING SIMD TESTS
+// ========================================================================
+
+/**
+ * Scalar reference biquad (JSFX form: y = b0*x + b1*x1 + b2*x2 - a1*y1 - a2*y2)
+ */
+struct ReferenceBiquad
+{
+    const double* c;
+    double x1{0}, x2{0}, y1{0}, y2{0};
+
+    double tick(double x)
+    {
+        double y = c[0] * x + c[1] * x1 + c[2] * x2 - c[3] * y1 - c[4] * y2;
+        x2 = x1; x1 = x;
+        y2 = y1; y1 = y;
+        return y;
+    }
+};
+
+TEST(KWeightingSIMDTest, ChannelBankMatchesScalarFilters)
+{
+    const double sampleRates[] = {44100.0, 48000.0, 96000.0, 192000.0};
+    constexpr int NUM_CHANNELS = 6;
+    constexpr int NUM_SAMPLES = 4096;
+    constexpr int STRIDE = SIMD::roundUpToLanes(NUM_CHANNELS);
+
+    for (double sr : sampleRates)
+    {
+        double hp[5], hs[5];
+        DSPSSOT::Helpers::calculateHighPassCoeffs(DSPSSOT::KWeighting::HIGH_PASS_FC,
+                                                  DSPSSOT::KWeighting::HIGH_PASS_Q, sr, hp);
+        DSPSSOT::Helpers::calculateHighShelfCoeffs(DSPSSOT::KWeighting::HIGH_SHELF_FC,
+                                                   DSPSSOT::KWeighting::HIGH_SHELF_Q,
+                                                   DSPSSOT::KWeighting::HIGH_SHELF_GAIN_DB, sr, hs);
+
+        KWeightingBank<NUM_CHANNELS> bank;
+        bank.setCoefficients(hp, hs);
+        bank.reset();
+
+        // Interleaved frames, one distinct signal per channel
+        alignas(SIMD::VECTOR_ALIGNMENT) static double frames[NUM_SAMPLES * STRIDE];
+        std::vector<double> reference(NUM_SAMPLES * NUM_CHANNELS);
+
+        for (int ch = 0; ch < NUM_CHANNELS; ch++)
+        {
+            ReferenceBiquad hpRef{hp}, hsRef{hs};
+            for (int i = 0; i < NUM_SAMPLES; i++)
+            {
+                double x = std::sin(0.01 * (ch + 1) * i) + 0.3 * (((i * 7919 + ch * 31) % 201) - 100) / 100.0;
+                frames[i * STRIDE + ch] = x;
+                reference[i * NUM_CHANNELS + ch] = hsRef.tick(hpRef.tick(x));
+            }
+        }
+        for (int ch = NUM_CHANNELS; ch < STRIDE; ch++)
+            for (int i = 0; i < NUM_SAMPLES; i++)
+                frames[i * STRIDE + ch] = 0.0;
+
+        // Split into a single frame and a block on the same filter state
+        bank.processFrames(frames, STRIDE, 1);
+        bank.processFrames(frames + STRIDE, STRIDE, NUM_SAMPLES - 1);
+
+        for (int i = 0; i < NUM_SAMPLES; i++)
+            for (int ch = 0; ch < NUM_CHANNELS; ch++)
+                ASSERT_EQ(frames[i * STRIDE + ch], reference[i * NUM_CHANNELS + ch])
+                    << "sr " << sr << " ch " << ch << " sample " << i;
+    }
+}
+
+// ========================================================================
+// SURROUND TESTS
+// ========================================================================
+
+/**
+ * Measure a 1 kHz tone placed on one channel of a 5.1 (L R C LFE Ls Rs) buffer
+ */
+static double measure51ToneOnChannel(int activeChannel)
+{
+    const double weights[6] = {
+        DSPSSOT::ChannelWeighting::FRONT, DSPSSOT::ChannelWeighting::FRONT,
+        DSPSSOT::ChannelWeighting::FRONT, DSPSSOT::ChannelWeighting::LFE,
+        DSPSSOT::ChannelWeighting::SURROUND, DSPSSOT::ChannelWeighting::SURROUND
+    };
+
+    BULLsEYEProcessorCore processor;
+    processor.setSampleRate(TEST_SAMPLE_RATE);
+    processor.setChannelWeights(weights, 6);
+
+    const int numSamples = 96000;
+    std::vector<std::vector<float>> buffers(6, std::vector<float>(numSamples, 0.0f));
+    for (int i = 0; i < numSamples; i++)
+        buffers[activeChannel][i] = static_cast<float>(0.5 * std::sin(DSPSSOT::Math::TAU * 1000.0 * i / TEST_SAMPLE_RATE));
+
+    const float* channels[6];
+    for (int ch = 0; ch < 6; ch++)
+        channels[ch] = buffers[ch].data();
+
+    for (int offset = 0; offset < numSamples; offset += 512)
+    {
+        const float* block[6];
+        for (int ch = 0; ch < 6; ch++)
+            block[ch] = channels[ch] + offset;
+        processor.processBlock(block, 6, std::min(512, numSamples - offset));
+    }
+
+    return processor.getIntegratedLUFS();
+}
+
+TEST(SurroundTest, SurroundChannelsWeightedByBS1770Gain)
+{
+    double front = measure51ToneOnChannel(0);
+    double surround = measure51ToneOnChannel(4);
+
+    EXPECT_GT(front, DSPSSOT::TruePeak::MIN_DISPLAY_DB);
+    EXPECT_NEAR(surround - front, 10.0 * std::log10(DSPSSOT::ChannelWeighting::SURROUND), 1e-6);
+}
+
+TEST(SurroundTest, LFEIsExcludedFromLoudness)
+{
+    EXPECT_DOUBLE_EQ(measure51ToneOnChannel(3), DSPSSOT::TruePeak::MIN_DISPLAY_DB);
+}
+
+TEST(SurroundTest, ImmersiveLayoutMeasuresAllChannels)
+{
+    // 7.1.4: 12 channels, one integrator, True Peak over every channel
+    BULLsEYEProcessorCore processor;
+    processor.setSampleRate(TEST_SAMPLE_RATE);
+
+    const int numSamples = 48000;
+    std::vector<std::vector<float>> buffers(12, std::vector<float>(numSamples, 0.0f));
+    for (int i = 0; i < numSamples; i++)
+        buffers[11][i] = static_cast<float>(0.9 * std::sin(DSPSSOT::Math::TAU * 1000.0 * i / TEST_SAMPLE_RATE));
+
+    const float* channels[12];
+    for (int ch = 0; ch < 12; ch++)
+        channels[ch] = buffers[ch].data();
+
+    processor.processBlock(channels, 12, numSamples);
+
+    EXPECT_GT(processor.getIntegratedLUFS(), DSPSSOT::TruePeak::MIN_DISPLAY_DB);
+    EXPECT_NEAR(processor.getTruePeakDB(), 20.0 * std::log10(0.9), 0.1);
+}
+
+// ========================================================================
+// MOMENTARY / SHORT-TERM LOUDNESS TESTS
+// ========================================================================
+
+using TestSignals::feedTone;
+
+TEST(LoudnessWindowTest, WindowsPublishOnlyOnceFull)
+{
+    BULLsEYEProcessorCore processor;
+    processor.setSampleRate(TEST_SAMPLE_RATE);
+
+    // 400 ms - 1 sample: neither window is full
+    feedTone(processor, 0.5, 19199);
+    EXPECT_DOUBLE_EQ(processor.getMomentaryLUFS(), DSPSSOT::TruePeak::MIN_DISPLAY_DB);
+    EXPECT_DOUBLE_EQ(processor.getShortTermLUFS(), DSPSSOT::TruePeak::MIN_DISPLAY_DB);
+
+    // 400 ms: momentary valid, short-term still filling
+    feedTone(processor, 0.5, 1);
+    EXPECT_GT(processor.getMomentaryLUFS(), DSPSSOT::TruePeak::MIN_DISPLAY_DB);
+    EXPECT_DOUBLE_EQ(processor.getShortTermLUFS(), DSPSSOT::TruePeak::MIN_DISPLAY_DB);
+
+    // 3 s: short-term valid
+    feedTone(processor, 0.5, 144000 - 19200);
+    EXPECT_GT(processor.getShortTermLUFS(), DSPSSOT::TruePeak::MIN_DISPLAY_DB);
+}
+
+TEST(LoudnessWindowTest, SteadyToneReadsEqualOnAllTimescales)
+{
+    BULLsEYEProcessorCore processor;
+    processor.setSampleRate(TEST_SAMPLE_RATE);
+    feedTone(processor, 0.5, 480000);
+
+    EXPECT_NEAR(processor.getMomentaryLUFS(), processor.getIntegratedLUFS(), 0.01);
+    EXPECT_NEAR(processor.getShortTermLUFS(), processor.getIntegratedLUFS(), 0.01);
+    EXPECT_NEAR(processor.getMaxMomentaryLUFS(), processor.getMomentaryLUFS(), 0.01);
+}
+
+TEST(LoudnessWindowTest, RunningSumsForgetOldProgram)
+{
+    // 10 s loud, then quiet: once the quiet section fills each window, the
+    // running sums must hold only quiet energy (no residue from the loud part)
+    BULLsEYEProcessorCore steadyQuiet;
+    steadyQuiet.setSampleRate(TEST_SAMPLE_RATE);
+    feedTone(steadyQuiet, 0.01, 480000);
+
+    BULLsEYEProcessorCore loudThenQuiet;
+    loudThenQuiet.setSampleRate(TEST_SAMPLE_RATE);
+    feedTone(loudThenQuiet, 0.9, 480000);
+    feedTone(loudThenQuiet, 0.01, 24000);
+
+    EXPECT_NEAR(loudThenQuiet.getMomentaryLUFS(), steadyQuiet.getMomentaryLUFS(), 0.05);
+
+    feedTone(loudThenQuiet, 0.01, 144000);
+    EXPECT_NEAR(loudThenQuiet.getShortTermLUFS(), steadyQuiet.getShortTermLUFS(), 0.05);
+
+    // Maxima hold the loud section
+    EXPECT_GT(loudThenQuiet.getMaxMomentaryLUFS(), steadyQuiet.getMomentaryLUFS() + 30.0);
+    EXPECT_GT(loudThenQuiet.getMaxShortTermLUFS(), steadyQuiet.getShortTermLUFS() + 30.0);
+}
+
+TEST(LoudnessWindowTest, ResetClearsWindowsAndMaxima)
+{
+    BULLsEYEProcessorCore processor;
+    processor.setSampleRate(TEST_SAMPLE_RATE);
+    feedTone(processor, 0.5, 192000);
+    processor.reset();
+
+    EXPECT_DOUBLE_EQ(processor.getMomentaryLUFS(), DSPSSOT::TruePeak::MIN_DISPLAY_DB);
+    EXPECT_DOUBLE_EQ(processor.getShortTermLUFS(), DSPSSOT::TruePeak::MIN_DISPLAY_DB);
+    EXPECT_DOUBLE_EQ(processor.getMaxMomentaryLUFS(), DSPSSOT::TruePeak::MIN_DISPLAY_DB);
+    EXPECT_DOUBLE_EQ(processor.getMaxShortTermLUFS(), DSPSSOT::TruePeak::MIN_DISPLAY_DB);
+}
+
+// ========================================================================
+// SEGMENTED MEASUREMENT TESTS
+// ========================================================================
+
+/**
+ * Program with loudness steps, a quiet passage and inter-sample peaks
+ */
+static std::vector<float> makeSteppedProgram(int numSamples)
+{
+    std::vector<float> buffer(numSamples);
+    for (int i = 0; i < numSamples; i++)
+    {
+        const int second = i / static_cast<int>(TEST_SAMPLE_RATE);
+        const double amplitude = (second % 7 == 3) ? 0.002 : 0.1 + 0.12 * (second % 5);
+        buffer[i] = static_cast<float>(amplitude * std::sin(DSPSSOT::Math::TAU * 997.0 * i / TEST_SAMPLE_RATE)
+                                     + 0.3 * amplitude * std::sin(DSPSSOT::Math::TAU * 11025.0 * i / TEST_SAMPLE_RATE));
+    }
+    return buffer;
+}
+
+static void feedRange(BULLsEYEProcessorCore& processor, const std::vector<float>& buffer, int start, int end)
+{
+    for (int offset = start; offset < end; offset += 1024)
+    {
+        const int n = std::min(1024, end - offset);
+        processor.processBlock(buffer.data() + offset, buffer.data() + offset, n);
+    }
+}
+
+TEST(SegmentedMeasurementTest, MergedSegmentsMatchSequentialPass)
+{
+    const int ring = DSPSSOT::Helpers::calculateSubBlockSize(TEST_SAMPLE_RATE)
+                   * DSPSSOT::LoudnessWindows::SHORT_TERM_SUB_BLOCKS;
+    const int numSamples = 10 * ring + 12345;
+    const std::vector<float> program = makeSteppedProgram(numSamples);
+    const int cuts[] = {0, 3 * ring, 7 * ring, numSamples};
+
+    auto sequential = std::make_unique<BULLsEYEProcessorCore>();
+    sequential->setSampleRate(TEST_SAMPLE_RATE);
+    feedRange(*sequential, program, 0, numSamples);
+
+    // Segment k warms up on the ring before its start, then measures [cut k, cut k+1)
+    std::vector<std::unique_ptr<BULLsEYEProcessorCore>> segments;
+    for (int k = 0; k < 3; k++)
+    {
+        segments.push_back(std::make_unique<BULLsEYEProcessorCore>());
+        segments[k]->setSampleRate(TEST_SAMPLE_RATE);
+        if (k > 0)
+        {
+            feedRange(*segments[k], program, cuts[k] - ring, cuts[k]);
+            segments[k]->resetMeasurement();
+        }
+        feedRange(*segments[k], program, cuts[k], cuts[k + 1]);
+    }
+    segments[0]->mergeMeasurement(*segments[1]);
+    segments[0]->mergeMeasurement(*segments[2]);
+
+    const MeterFrame expected = sequential->getMeterFrame();
+    const MeterFrame merged = segments[0]->getMeterFrame();
+    EXPECT_NEAR(merged.integratedLUFS, expected.integratedLUFS, EPSILON);
+    EXPECT_NEAR(merged.loudnessRangeLU, expected.loudnessRangeLU, EPSILON);
+    EXPECT_NEAR(merged.maxMomentaryLUFS, expected.maxMomentaryLUFS, EPSILON);
+    EXPECT_NEAR(merged.maxShortTermLUFS, expected.maxShortTermLUFS, EPSILON);
+    EXPECT_NEAR(merged.momentaryLUFS, expected.momentaryLUFS, EPSILON);
+    EXPECT_DOUBLE_EQ(merged.truePeakDB, expected.truePeakDB);
+    EXPECT_EQ(merged.sampleSum, expected.sampleSum);
+    EXPECT_EQ(merged.samplePosition, expected.samplePosition);
+    EXPECT_EQ(merged.totalSamplesProcessed, expected.totalSamplesProcessed);
+    EXPECT_GT(merged.loudnessRangeLU, 1.0);
+}
+
+TEST(SegmentedMeasurementTest, ResetMeasurementForgetsWarmUp)
+{
+    BULLsEYEProcessorCore processor;
+    processor.setSampleRate(TEST_SAMPLE_RATE);
+    feedTone(processor, 0.9, 192000);
+    processor.resetMeasurement();
+
+    EXPECT_DOUBLE_EQ(processor.getIntegratedLUFS(), DSPSSOT::TruePeak::MIN_DISPLAY_DB);
+    EXPECT_DOUBLE_EQ(processor.getTruePeakDB(), DSPSSOT::TruePeak::MIN_DISPLAY_DB);
+    EXPECT_DOUBLE_EQ(processor.getMaxMomentaryLUFS(), DSPSSOT::TruePeak::MIN_DISPLAY_DB);
+    EXPECT_EQ(processor.getTotalSamplesProcessed(), 0);
+
+    // Windows are still full: the first hop after the reset measures at once
+    feedTone(processor, 0.9, 4800);
+    EXPECT_GT(processor.getShortTermLUFS(), DSPSSOT::TruePeak::MIN_DISPLAY_DB);
+    EXPECT_GT(processor.getIntegratedLUFS(), DSPSSOT::TruePeak::MIN_DISPLAY_DB);
+}
+
 // ========================================================================
 // TETRIS COMPLIANCE TESTS
 // ========================================================================
@@ -0,0 +1,191 @@
+/**
+ * @file TestCallbackTiming.cpp
+ * @brief Unit tests for audio-thread callback timing
+ *
+ * Tests verify:
+ * - Log buckets cover the uint64 range with bounded relative width
+ * - Percentiles, mean and worst case of known distributions
+ * - Budget utilisation and overruns relative to the buffer length
+ * - Real processBlock timings can be dumped (printed) from a test
+ *
+ * @note Tests are designed to run without JUCE dependencies
+ */
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <vector>
+#include "DSP/BULLsEYEProcessor.h"
+#include "DSP/CallbackTiming.h"
+#include "SSOT/DSPSSOT.h"
+
+// ========================================================================
+// HELPER FUNCTIONS
+// ========================================================================
+
+namespace
+{
+    constexpr double TEST_SAMPLE_RATE = 48000.0;
+}
+
+// ========================================================================
+// LOG-BUCKET HISTOGRAM
+// ========================================================================
+
+/**
+ * Every value lands in a bucket whose bounds contain it; small values are exact
+ */
+TEST(LogBucketHistogramTest, BucketsContainTheirValues)
+{
+    constexpr int sub = LogBucketHistogram::SUB_BUCKETS;
+
+    for (std::uint64_t v = 0; v < 2 * sub; ++v)
+        EXPECT_EQ(LogBucketHistogram::bucketFor(v), static_cast<int>(v));
+
+    int previous = -1;
+    for (std::uint64_t v = 1; v < (std::uint64_t{1} << 62); v = v * 3 / 2 + 1)
+    {
+        const int bucket = LogBucketHistogram::bucketFor(v);
+        ASSERT_GE(bucket, previous) << "buckets must be monotonic, value " << v;
+        ASSERT_LT(static_cast<double>(v), LogBucketHistogram::bucketUpperBound(bucket));
+        if (bucket > 0)
+        {
+            ASSERT_GE(static_cast<double>(v), LogBucketHistogram::bucketUpperBound(bucket - 1));
+        }
+
+        // Relative width bounded by 2^-SUB_BITS
+        const double lower = bucket > 0 ? LogBucketHistogram::bucketUpperBound(bucket - 1) : 0.0;
+        if (v >= 2 * sub)
+        {
+            EXPECT_LE((LogBucketHistogram::bucketUpperBound(bucket) - lower) / lower, 1.0 / sub + 1e-12);
+        }
+        previous = bucket;
+    }
+
+    EXPECT_EQ(LogBucketHistogram::bucketFor(UINT64_MAX), LogBucketHistogram::NUM_BUCKETS - 1);
+}
+
+/**
+ * Uniform 1..1000: p50 / p99 within one bucket width, exact mean and max
+ */
+TEST(LogBucketHistogramTest, PercentilesOfUniformDistribution)
+{
+    auto histogram = std::make_unique<LogBucketHistogram>();
+    for (std::uint64_t v = 1; v <= 1000; ++v)
+        histogram->add(v);
+
+    const double tolerance = 1.0 / LogBucketHistogram::SUB_BUCKETS;
+    EXPECT_EQ(histogram->getCount(), 1000u);
+    EXPECT_DOUBLE_EQ(histogram->getMean(), 500.5);
+    EXPECT_EQ(histogram->getMax(), 1000u);
+    EXPECT_NEAR(histogram->percentile(0.50), 500.0, 500.0 * tolerance);
+    EXPECT_NEAR(histogram->percentile(0.99), 990.0, 990.0 * tolerance);
+    EXPECT_LE(histogram->percentile(1.0), 1000.0);   // capped at the observed max
+
+    histogram->reset();
+    EXPECT_EQ(histogram->getCount(), 0u);
+    EXPECT_DOUBLE_EQ(histogram->percentile(0.99), 0.0);
+}
+
+/**
+ * One outlier in 1000 callbacks moves the worst case but not p99
+ */
+TEST(LogBucketHistogramTest, OutlierShowsInWorstCaseOnly)
+{
+    auto histogram = std::make_unique<LogBucketHistogram>();
+    for (int i = 0; i < 999; ++i)
+        histogram->add(10000);
+    histogram->add(5000000);
+
+    EXPECT_LE(histogram->percentile(0.99), 10000.0 * (1.0 + 1.0 / LogBucketHistogram::SUB_BUCKETS));
+    EXPECT_EQ(histogram->getMax(), 5000000u);
+}
+
+// ========================================================================
+// CALLBACK TIMER
+// ========================================================================
+
+/**
+ * Utilisation is duration / buffer length; longer-than-buffer callbacks are overruns
+ */
+TEST(CallbackTimerTest, UtilisationRelativeToBufferLength)
+{
+    auto timer = std::make_unique<CallbackTimer>();
+    timer->prepare(TEST_SAMPLE_RATE);
+
+    // 480 samples at 48 kHz = 10 ms budget
+    for (int i = 0; i < 99; ++i)
+        timer->record(1000000, 480);   // 1 ms = 10%
+    timer->record(20000000, 480);      // 20 ms = 200% (overrun)
+
+    const CallbackTimingStats stats = timer->getStats();
+    const double tolerance = 1.0 / LogBucketHistogram::SUB_BUCKETS;
+
+    EXPECT_EQ(stats.callbacks, 100u);
+    EXPECT_EQ(stats.overruns, 1u);
+    EXPECT_DOUBLE_EQ(stats.worstNs, 20000000.0);
+    EXPECT_NEAR(stats.p50Ns, 1000000.0, 1000000.0 * tolerance);
+    EXPECT_NEAR(stats.meanUtilisation, (99 * 0.1 + 2.0) / 100.0, 1e-6);
+    EXPECT_NEAR(stats.p99Utilisation, 0.1, 0.1 * tolerance);
+    EXPECT_NEAR(stats.worstUtilisation, 2.0, 1e-6);
+
+    timer->prepare(TEST_SAMPLE_RATE);
+    EXPECT_EQ(timer->getStats().callbacks, 0u);
+    EXPECT_EQ(timer->getStats().overruns, 0u);
+}
+
+/**
+ * Scope records one callback with a non-negative duration
+ */
+TEST(CallbackTimerTest, ScopeRecordsOneCallback)
+{
+    auto timer = std::make_unique<CallbackTimer>();
+    timer->prepare(TEST_SAMPLE_RATE);
+
+    {
+        const CallbackTimer::Scope scope(*timer, 512);
+    }
+
+    EXPECT_EQ(timer->getStats().callbacks, 1u);
+    EXPECT_GE(timer->getStats().worstNs, 0.0);
+}
+
+/**
+ * Time the DSP core at a typical host buffer and dump the statistics
+ */
+TEST(CallbackTimerTest, DumpCoreProcessBlockTiming)
+{
+    constexpr int bufferSize = 512;
+    constexpr int numCallbacks = 1000;   // ~10.7 s of audio
+
+    std::vector<float> left(bufferSize), right(bufferSize);
+    for (int i = 0; i < bufferSize; ++i)
+    {
+        left[static_cast<size_t>(i)] = static_cast<float>(0.25 * std::sin(DSPSSOT::Math::TAU * 997.0 * i / TEST_SAMPLE_RATE));
+        right[static_cast<size_t>(i)] = left[static_cast<size_t>(i)];
+    }
+    const float* channels[2] = {left.data(), right.data()};
+
+    auto core = std::make_unique<BULLsEYEProcessorCore>();
+    core->setSampleRate(TEST_SAMPLE_RATE);
+    auto timer = std::make_unique<CallbackTimer>();
+    timer->prepare(TEST_SAMPLE_RATE);
+
+    for (int i = 0; i < numCallbacks; ++i)
+    {
+        const CallbackTimer::Scope scope(*timer, bufferSize);
+        core->processBlock(channels, 2, bufferSize);
+    }
+
+    const CallbackTimingStats stats = timer->getStats();
+    std::cout << "[ TIMING   ] processBlock 48 kHz stereo, " << bufferSize << " frames: "
+              << formatTimingStats(stats) << std::endl;
+
+    EXPECT_EQ(stats.callbacks, static_cast<std::uint64_t>(numCallbacks));
+    EXPECT_GT(stats.meanNs, 0.0);
+    EXPECT_LE(stats.p50Ns, stats.p99Ns);
+    EXPECT_LE(stats.p99Ns, stats.worstNs);
+    EXPECT_LE(stats.p99Utilisation, stats.worstUtilisation);
+}
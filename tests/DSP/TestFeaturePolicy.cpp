@@ -0,0 +1,234 @@
+/**
+ * @file TestFeaturePolicy.cpp
+ * @brief Unit tests for the compile-time feature sets of the DSP core
+ *
+ * Tests verify:
+ * - Lean cores report exactly what the full core reports for their meters
+ * - Disabled meters read as MeterFrame defaults
+ * - Disabled stages take no state (core and published frame shrink)
+ * - Per-sample and block paths, reset and segment merge in lean cores
+ *
+ * @note Tests are designed to run without JUCE dependencies
+ */
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <memory>
+#include <vector>
+#include "DSP/BULLsEYEProcessor.h"
+#include "DSP/FeaturePolicy.h"
+#include "SSOT/DSPSSOT.h"
+
+// ========================================================================
+// HELPER FUNCTIONS
+// ========================================================================
+
+namespace
+{
+    constexpr double TEST_SAMPLE_RATE = 48000.0;
+    constexpr int TEST_SECONDS = 8;
+
+    template<typename FeatureSet>
+    using Core = BasicBULLsEYEProcessorCore<Precision::Double, FeatureSet>;
+
+    /**
+     * Stereo programme with a level change (non-trivial gating, LRA and True Peak)
+     */
+    struct TestSignal
+    {
+        std::vector<float> left, right;
+
+        TestSignal()
+        {
+            const int n = static_cast<int>(TEST_SECONDS * TEST_SAMPLE_RATE);
+            for (int i = 0; i < n; ++i)
+            {
+                const double t = i / TEST_SAMPLE_RATE;
+                const double gain = (i < n / 2) ? 0.5 : 0.05;
+                left.push_back(static_cast<float>(gain * std::sin(DSPSSOT::Math::TAU * 997.0 * t)));
+                right.push_back(static_cast<float>(gain * std::sin(DSPSSOT::Math::TAU * 11025.0 * t + 0.3)));
+            }
+        }
+
+        int size() const { return static_cast<int>(left.size()); }
+    };
+
+    const TestSignal& testSignal()
+    {
+        static const TestSignal signal;
+        return signal;
+    }
+
+    template<typename FeatureSet>
+    MeterFrame measureBlocks(int blockSize)
+    {
+        const TestSignal& signal = testSignal();
+        auto core = std::make_unique<Core<FeatureSet>>();
+        core->setSampleRate(TEST_SAMPLE_RATE);
+
+        for (int offset = 0; offset < signal.size(); offset += blockSize)
+        {
+            const int n = std::min(blockSize, signal.size() - offset);
+            core->processBlock(signal.left.data() + offset, signal.right.data() + offset, n);
+        }
+        return core->getMeterFrame();
+    }
+
+    template<typename FeatureSet>
+    MeterFrame measurePerSample()
+    {
+        const TestSignal& signal = testSignal();
+        auto core = std::make_unique<Core<FeatureSet>>();
+        core->setSampleRate(TEST_SAMPLE_RATE);
+
+        for (int i = 0; i < signal.size(); ++i)
+        {
+            float l = signal.left[static_cast<size_t>(i)];
+            float r = signal.right[static_cast<size_t>(i)];
+            core->process(l, r);
+        }
+        return core->getMeterFrame();
+    }
+}
+
+// ========================================================================
+// MEASUREMENTS
+// ========================================================================
+
+/**
+ * The analyzer set reports every meter bit-identically to the full core
+ */
+TEST(FeaturePolicyTest, AnalyzerSetMatchesFullCore)
+{
+    const MeterFrame full = measureBlocks<Features::All>(512);
+    const MeterFrame lean = measureBlocks<Features::Analyzer>(512);
+
+    EXPECT_EQ(lean.integratedLUFS, full.integratedLUFS);
+    EXPECT_EQ(lean.deviationLU, full.deviationLU);
+    EXPECT_EQ(lean.sampleSum, full.sampleSum);
+    EXPECT_EQ(lean.truePeakDB, full.truePeakDB);
+    EXPECT_EQ(lean.momentaryLUFS, full.momentaryLUFS);
+    EXPECT_EQ(lean.shortTermLUFS, full.shortTermLUFS);
+    EXPECT_EQ(lean.maxMomentaryLUFS, full.maxMomentaryLUFS);
+    EXPECT_EQ(lean.maxShortTermLUFS, full.maxShortTermLUFS);
+    EXPECT_EQ(lean.loudnessRangeLU, full.loudnessRangeLU);
+    EXPECT_EQ(lean.totalSamplesProcessed, full.totalSamplesProcessed);
+    EXPECT_EQ(lean.samplePosition, full.samplePosition);
+}
+
+/**
+ * LUFS-I only: integrated loudness exact, every other meter at its default
+ */
+TEST(FeaturePolicyTest, IntegratedOnlyReportsIntegratedLoudness)
+{
+    const MeterFrame full = measureBlocks<Features::All>(512);
+    const MeterFrame lean = measureBlocks<Features::IntegratedOnly>(512);
+    const MeterFrame defaults;
+
+    EXPECT_GT(full.integratedLUFS, DSPSSOT::TruePeak::MIN_DISPLAY_DB);
+    EXPECT_EQ(lean.integratedLUFS, full.integratedLUFS);
+    EXPECT_EQ(lean.deviationLU, full.deviationLU);
+    EXPECT_EQ(lean.sampleSum, full.sampleSum);
+    EXPECT_EQ(lean.samplePosition, full.samplePosition);
+
+    EXPECT_EQ(lean.truePeakDB, defaults.truePeakDB);
+    EXPECT_EQ(lean.momentaryLUFS, defaults.momentaryLUFS);
+    EXPECT_EQ(lean.maxShortTermLUFS, defaults.maxShortTermLUFS);
+    EXPECT_EQ(lean.loudnessRangeLU, defaults.loudnessRangeLU);
+}
+
+/**
+ * True Peak only: True Peak exact, no loudness
+ */
+TEST(FeaturePolicyTest, TruePeakOnlyReportsTruePeak)
+{
+    const MeterFrame full = measureBlocks<Features::All>(512);
+    const MeterFrame lean = measureBlocks<Features::TruePeakOnly>(512);
+    const MeterFrame defaults;
+
+    EXPECT_GT(full.truePeakDB, -10.0);
+    EXPECT_EQ(lean.truePeakDB, full.truePeakDB);
+    EXPECT_EQ(lean.totalSamplesProcessed, full.totalSamplesProcessed);
+
+    EXPECT_EQ(lean.integratedLUFS, defaults.integratedLUFS);
+    EXPECT_EQ(lean.sampleSum, 0);
+    EXPECT_EQ(lean.maxMomentaryLUFS, defaults.maxMomentaryLUFS);
+    EXPECT_EQ(lean.loudnessRangeLU, defaults.loudnessRangeLU);
+}
+
+/**
+ * Per-sample process() honours the feature set the same way
+ */
+TEST(FeaturePolicyTest, PerSamplePathMatchesFullCore)
+{
+    const MeterFrame full = measurePerSample<Features::All>();
+
+    EXPECT_EQ(measurePerSample<Features::IntegratedOnly>().integratedLUFS, full.integratedLUFS);
+    EXPECT_EQ(measurePerSample<Features::TruePeakOnly>().truePeakDB, full.truePeakDB);
+    EXPECT_EQ(measurePerSample<Features::Analyzer>().loudnessRangeLU, full.loudnessRangeLU);
+}
+
+/**
+ * Segmented measurement merges exactly in a lean core
+ */
+TEST(FeaturePolicyTest, LeanCoreMergesSegments)
+{
+    const TestSignal& signal = testSignal();
+    const int half = static_cast<int>(4 * TEST_SAMPLE_RATE);
+    const int warmUp = static_cast<int>(3 * TEST_SAMPLE_RATE);
+
+    auto sequential = std::make_unique<Core<Features::IntegratedOnly>>();
+    auto first = std::make_unique<Core<Features::IntegratedOnly>>();
+    auto second = std::make_unique<Core<Features::IntegratedOnly>>();
+    for (auto* core : {sequential.get(), first.get(), second.get()})
+        core->setSampleRate(TEST_SAMPLE_RATE);
+
+    sequential->processBlock(signal.left.data(), signal.right.data(), signal.size());
+    first->processBlock(signal.left.data(), signal.right.data(), half);
+    second->processBlock(signal.left.data() + half - warmUp, signal.right.data() + half - warmUp, warmUp);
+    second->resetMeasurement();
+    second->processBlock(signal.left.data() + half, signal.right.data() + half, signal.size() - half);
+    first->mergeMeasurement(*second);
+
+    EXPECT_EQ(first->getIntegratedLUFS(), sequential->getIntegratedLUFS());
+}
+
+/**
+ * reset() clears a lean core back to its initial readings
+ */
+TEST(FeaturePolicyTest, LeanCoreResets)
+{
+    auto core = std::make_unique<Core<Features::TruePeakOnly>>();
+    core->setSampleRate(TEST_SAMPLE_RATE);
+    core->processBlock(testSignal().left.data(), testSignal().right.data(), 48000);
+    EXPECT_GT(core->getTruePeakDB(), DSPSSOT::TruePeak::MIN_DISPLAY_DB);
+
+    core->reset();
+    EXPECT_EQ(core->getTruePeakDB(), DSPSSOT::TruePeak::MIN_DISPLAY_DB);
+    EXPECT_EQ(core->getHistoryDroppedCount(), 0u);
+    EXPECT_EQ(core->drainHistory([](const LoudnessHopRecord&) {}), 0u);
+}
+
+// ========================================================================
+// COMPILED-OUT STATE
+// ========================================================================
+
+/**
+ * Disabled stages take no state: histograms, filter bank, True Peak, atomics
+ */
+TEST(FeaturePolicyTest, DisabledStagesTakeNoSpace)
+{
+    EXPECT_LT(sizeof(Core<Features::Analyzer>), sizeof(Core<Features::All>));
+    EXPECT_LT(sizeof(Core<Features::IntegratedOnly>), sizeof(Core<Features::Analyzer>));
+    EXPECT_LT(sizeof(Core<Features::TruePeakOnly>), sizeof(Core<Features::Analyzer>));
+
+    // No True Peak detector and no LRA histogram
+    EXPECT_LE(sizeof(Core<Features::IntegratedOnly>) + sizeof(LoudnessHistogram) + sizeof(TruePeakDetector<12>),
+              sizeof(Core<Features::Analyzer>));
+
+    // No filter bank, no scratch, no histograms
+    EXPECT_LE(sizeof(Core<Features::TruePeakOnly>) + 2 * sizeof(LoudnessHistogram),
+              sizeof(Core<Features::Analyzer>));
+
+    EXPECT_LT(sizeof(BasicMeterFrameSeqlock<Features::TruePeakOnly>), sizeof(MeterFrameSeqlock));
+}
@@ -0,0 +1,289 @@
+/**
+ * @file TestHalfbandDecimator.cpp
+ * @brief Unit tests for the halfband decimator and the high-rate loudness path
+ *
+ * Tests verify:
+ * - Decimation factor follows the sample rate (output >= 44.1 kHz, whole hops)
+ * - Passband flatness and stopband attenuation of the cascade
+ * - Streaming: any split of the input gives bit-identical output
+ * - High-rate loudness stays within HighRate::ACCURACY_BOUND_LU of the
+ *   native-rate measurement for programme band-limited to 20 kHz
+ * - Per-sample and block paths stay bit-identical (including silence)
+ * - True Peak still runs on the native-rate signal
+ *
+ * @note Tests are designed to run without JUCE dependencies
+ */
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <memory>
+#include <vector>
+#include "DSP/BULLsEYEProcessor.h"
+#include "DSP/HalfbandDecimator.h"
+#include "SSOT/DSPSSOT.h"
+#include "TestSignals.h"
+
+// ========================================================================
+// HELPER FUNCTIONS
+// ========================================================================
+
+namespace
+{
+    using TestSignals::CoreOptions;
+    using TestSignals::makeCore;
+    using Decimator = HalfbandDecimator<2>;
+    constexpr int STRIDE = Decimator::MAX_STRIDE;
+
+    /**
+     * RMS of a decimated mono sine, after the filters have settled
+     */
+    double decimatedRms(double sampleRate, double frequency, int factor)
+    {
+        const int numSamples = static_cast<int>(sampleRate);  // 1 s
+        alignas(SIMD::VECTOR_ALIGNMENT) static double frames[384000 * STRIDE];
+        for (int i = 0; i < numSamples; ++i)
+        {
+            frames[i * STRIDE] = std::sin(DSPSSOT::Math::TAU * frequency * i / sampleRate);
+            for (int ch = 1; ch < STRIDE; ++ch)
+                frames[i * STRIDE + ch] = 0.0;
+        }
+
+        auto decimator = std::make_unique<Decimator>();
+        decimator->setFactor(factor);
+        const int numOut = decimator->processFrames(frames, STRIDE, numSamples);
+        EXPECT_EQ(numOut, numSamples / factor);
+
+        double sum = 0.0;
+        for (int i = numOut / 2; i < numOut; ++i)
+            sum += frames[i * STRIDE] * frames[i * STRIDE];
+        return std::sqrt(sum / (numOut - numOut / 2));
+    }
+
+    /**
+     * Band-limited stereo programme (tones 50 Hz - 19 kHz) with a level
+     * change, so gating, momentary and short-term all see real content
+     */
+    struct Programme
+    {
+        std::vector<float> left, right;
+
+        Programme(double sampleRate, int seconds)
+        {
+            const double tones[] = {50.0, 440.0, 997.0, 3150.0, 8000.0, 12500.0, 19000.0};
+            const int n = static_cast<int>(seconds * sampleRate);
+            for (int i = 0; i < n; ++i)
+            {
+                const double t = i / sampleRate;
+                const double gain = (i < n / 2) ? 0.08 : 0.01;
+                double l = 0.0, r = 0.0;
+                for (int k = 0; k < 7; ++k)
+                {
+                    l += gain * std::sin(DSPSSOT::Math::TAU * tones[k] * t + 0.3 * k);
+                    r += gain * std::sin(DSPSSOT::Math::TAU * tones[6 - k] * t + 0.7 * k);
+                }
+                left.push_back(static_cast<float>(l));
+                right.push_back(static_cast<float>(r));
+            }
+        }
+
+        int size() const { return static_cast<int>(left.size()); }
+    };
+
+    MeterFrame measureBlocks(const Programme& programme, double sampleRate, bool decimate, int blockSize)
+    {
+        auto core = makeCore(sampleRate, CoreOptions::withHighRateDecimation(decimate));
+        for (int offset = 0; offset < programme.size(); offset += blockSize)
+        {
+            const int n = std::min(blockSize, programme.size() - offset);
+            core->processBlock(programme.left.data() + offset, programme.right.data() + offset, n);
+        }
+        return core->getMeterFrame();
+    }
+}
+
+// ========================================================================
+// DECIMATION FACTOR
+// ========================================================================
+
+/**
+ * Native rate below 176.4 kHz; above, halve while the output stays >= 44.1 kHz
+ */
+TEST(HalfbandDecimatorTest, FactorFollowsSampleRate)
+{
+    using DSPSSOT::Helpers::highRateDecimationFactor;
+
+    EXPECT_EQ(highRateDecimationFactor(48000.0), 1);
+    EXPECT_EQ(highRateDecimationFactor(96000.0), 1);
+    EXPECT_EQ(highRateDecimationFactor(176400.0), 4);
+    EXPECT_EQ(highRateDecimationFactor(192000.0), 4);
+    EXPECT_EQ(highRateDecimationFactor(352800.0), 8);
+    EXPECT_EQ(highRateDecimationFactor(384000.0), 8);
+    EXPECT_EQ(highRateDecimationFactor(768000.0), 16);
+
+    // Hops must stay whole: 17702 samples split 2:1 but not 4:1, 17701 not at all
+    EXPECT_EQ(highRateDecimationFactor(177020.0), 2);
+    EXPECT_EQ(highRateDecimationFactor(177010.0), 1);
+
+    auto core = makeCore(192000.0, CoreOptions::withHighRateDecimation(false));
+    EXPECT_EQ(core->getDecimationFactor(), 1);
+    core->setHighRateDecimation(true);
+    EXPECT_EQ(core->getDecimationFactor(), 4);
+    core->setSampleRate(48000.0);
+    EXPECT_EQ(core->getDecimationFactor(), 1);
+}
+
+// ========================================================================
+// FREQUENCY RESPONSE
+// ========================================================================
+
+/**
+ * 0 - 20 kHz passes unchanged at every factor
+ */
+TEST(HalfbandDecimatorTest, PassbandIsFlat)
+{
+    for (const double frequency : {100.0, 1000.0, 10000.0, 19000.0, 20000.0})
+    {
+        SCOPED_TRACE(frequency);
+        EXPECT_NEAR(decimatedRms(192000.0, frequency, 4), std::sqrt(0.5), 1e-4);
+        EXPECT_NEAR(decimatedRms(176400.0, frequency, 4), std::sqrt(0.5), 1e-4);
+        EXPECT_NEAR(decimatedRms(384000.0, frequency, 8), std::sqrt(0.5), 1e-4);
+    }
+}
+
+/**
+ * Content that would alias into the output band is attenuated >= 70 dB
+ */
+TEST(HalfbandDecimatorTest, StopbandIsAttenuated)
+{
+    const double limit = std::sqrt(0.5) * std::pow(10.0, -70.0 / 20.0);
+
+    // 192k -> 48k: everything from 26.2 kHz up folds onto 0 - 21.8 kHz
+    for (const double frequency : {27000.0, 30000.0, 40000.0, 50000.0, 70000.0, 90000.0})
+    {
+        SCOPED_TRACE(frequency);
+        EXPECT_LT(decimatedRms(192000.0, frequency, 4), limit);
+    }
+
+    // 176.4k -> 44.1k: stopband from 24.1 kHz
+    for (const double frequency : {24200.0, 30000.0, 60000.0, 85000.0})
+    {
+        SCOPED_TRACE(frequency);
+        EXPECT_LT(decimatedRms(176400.0, frequency, 4), limit);
+    }
+}
+
+// ========================================================================
+// STREAMING
+// ========================================================================
+
+/**
+ * Uneven calls (single frames, odd runs) give the same output as one call
+ */
+TEST(HalfbandDecimatorTest, StreamingMatchesSingleCall)
+{
+    constexpr int numSamples = 4096;
+    std::vector<double> input(numSamples * STRIDE, 0.0);
+    for (int i = 0; i < numSamples; ++i)
+    {
+        input[static_cast<size_t>(i * STRIDE)] = std::sin(0.01 * i) + 0.3 * std::sin(2.7 * i);
+        input[static_cast<size_t>(i * STRIDE + 1)] = std::cos(0.003 * i);
+    }
+
+    alignas(SIMD::VECTOR_ALIGNMENT) static double whole[numSamples * STRIDE];
+    std::copy(input.begin(), input.end(), whole);
+    auto reference = std::make_unique<Decimator>();
+    reference->setFactor(8);
+    ASSERT_EQ(reference->processFrames(whole, STRIDE, numSamples), numSamples / 8);
+
+    auto streamed = std::make_unique<Decimator>();
+    streamed->setFactor(8);
+    alignas(SIMD::VECTOR_ALIGNMENT) static double chunk[64 * STRIDE];
+    std::vector<double> output;
+    const int sizes[] = {1, 3, 7, 1, 1, 64, 13, 2, 5};
+    for (int offset = 0, k = 0; offset < numSamples; ++k)
+    {
+        const int n = std::min(sizes[k % 9], numSamples - offset);
+        std::copy(input.begin() + offset * STRIDE, input.begin() + (offset + n) * STRIDE, chunk);
+        const int numOut = streamed->processFrames(chunk, STRIDE, n);
+        output.insert(output.end(), chunk, chunk + numOut * STRIDE);
+        offset += n;
+    }
+
+    ASSERT_EQ(output.size(), static_cast<size_t>(numSamples / 8 * STRIDE));
+    for (size_t i = 0; i < output.size(); ++i)
+        ASSERT_EQ(output[i], whole[i]) << "at " << i;
+}
+
+// ========================================================================
+// HIGH-RATE LOUDNESS PATH
+// ========================================================================
+
+/**
+ * Documented accuracy bound: programme band-limited to 20 kHz measures
+ * within HighRate::ACCURACY_BOUND_LU of the native-rate path. The
+ * decimator itself adds almost nothing: the result matches a native
+ * measurement of the same programme at the decimated rate
+ * (the remaining difference is K-weighting's response at 44.1 / 48 kHz)
+ */
+TEST(HalfbandDecimatorTest, HighRateLoudnessWithinAccuracyBound)
+{
+    constexpr double bound = DSPSSOT::HighRate::ACCURACY_BOUND_LU;
+    constexpr double decimatorError = 0.001;
+
+    for (const double rate : {176400.0, 192000.0, 384000.0})
+    {
+        SCOPED_TRACE(rate);
+        const double decimatedRate = rate / DSPSSOT::Helpers::highRateDecimationFactor(rate);
+        const Programme programme(rate, 8);
+        const MeterFrame native = measureBlocks(programme, rate, false, 4096);
+        const MeterFrame decimated = measureBlocks(programme, rate, true, 4096);
+        const MeterFrame lowRate = measureBlocks(Programme(decimatedRate, 8), decimatedRate, false, 4096);
+
+        EXPECT_GT(native.integratedLUFS, -30.0);
+        EXPECT_NEAR(decimated.integratedLUFS, native.integratedLUFS, bound);
+        EXPECT_NEAR(decimated.momentaryLUFS, native.momentaryLUFS, bound);
+        EXPECT_NEAR(decimated.maxMomentaryLUFS, native.maxMomentaryLUFS, bound);
+        EXPECT_NEAR(decimated.maxShortTermLUFS, native.maxShortTermLUFS, bound);
+
+        EXPECT_NEAR(decimated.integratedLUFS, lowRate.integratedLUFS, decimatorError);
+        EXPECT_NEAR(decimated.maxShortTermLUFS, lowRate.maxShortTermLUFS, decimatorError);
+        EXPECT_NEAR(decimated.loudnessRangeLU, lowRate.loudnessRangeLU, decimatorError);
+
+        // Hop timing and gated duration stay in native samples
+        EXPECT_EQ(decimated.sampleSum, native.sampleSum);
+        EXPECT_EQ(decimated.samplePosition, native.samplePosition);
+
+        // True Peak is measured on the native-rate signal
+        EXPECT_EQ(decimated.truePeakDB, native.truePeakDB);
+    }
+}
+
+/**
+ * Per-sample process() matches processBlock bit for bit in high-rate mode,
+ * across odd block sizes and a stretch of silence (fast path)
+ */
+TEST(HalfbandDecimatorTest, PerSampleMatchesBlockPath)
+{
+    constexpr double rate = 192000.0;
+    Programme programme(rate, 4);
+    std::fill(programme.left.begin() + 250000, programme.left.begin() + 500001, 0.0f);
+    std::fill(programme.right.begin() + 250000, programme.right.begin() + 500001, 0.0f);
+
+    const MeterFrame block = measureBlocks(programme, rate, true, 1001);
+
+    auto core = makeCore(rate, CoreOptions::withHighRateDecimation(true));
+    for (int i = 0; i < programme.size(); ++i)
+    {
+        float l = programme.left[static_cast<size_t>(i)];
+        float r = programme.right[static_cast<size_t>(i)];
+        core->process(l, r);
+    }
+    const MeterFrame perSample = core->getMeterFrame();
+
+    EXPECT_EQ(perSample.integratedLUFS, block.integratedLUFS);
+    EXPECT_EQ(perSample.momentaryLUFS, block.momentaryLUFS);
+    EXPECT_EQ(perSample.maxMomentaryLUFS, block.maxMomentaryLUFS);
+    EXPECT_EQ(perSample.shortTermLUFS, block.shortTermLUFS);
+    EXPECT_EQ(perSample.truePeakDB, block.truePeakDB);
+    EXPECT_EQ(perSample.samplePosition, block.samplePosition);
+}
@@ -0,0 +1,244 @@
+/**
+ * @file TestKWeightingBlockFilter.cpp
+ * @brief Unit tests for the block-parallel (state-space) K-weighting filter
+ *
+ * Tests verify:
+ * - Outputs match KWeightingBank per sample at 44.1 - 384 kHz: relative error
+ *   below 1e-9 wherever |y| is within 20 dB of the peak, absolute error below
+ *   1e-10 of the peak everywhere (relative error is unbounded at zero crossings)
+ * - Any split of the input (single samples, odd runs) stays within those bounds
+ * - Decayed state is flushed to zero like the bank
+ * - In the core, block-parallel mode measures the same loudness as the bank
+ *   (block and per-sample paths)
+ *
+ * @note Tests are designed to run without JUCE dependencies
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+#include "DSP/BULLsEYEProcessor.h"
+#include "DSP/KWeightingBlockFilter.h"
+#include "DSP/KWeightingFilter.h"
+#include "SSOT/DSPSSOT.h"
+#include "TestSignals.h"
+
+// ========================================================================
+// HELPER FUNCTIONS
+// ========================================================================
+
+namespace
+{
+    using TestSignals::CoreOptions;
+    using TestSignals::makeCore;
+    using BlockFilter = KWeightingBlockFilter<2>;
+    using Bank = KWeightingBank<2>;
+    constexpr int STRIDE = Bank::MAX_STRIDE;
+    constexpr double RELATIVE_TOLERANCE = 1e-9;    // per sample, where |y| >= RELATIVE_FLOOR * peak
+    constexpr double RELATIVE_FLOOR = 0.1;         // -20 dB
+    constexpr double ABSOLUTE_TOLERANCE = 1e-10;   // every sample, relative to the largest output
+    constexpr double LUFS_TOLERANCE = 1e-9;
+    using Frames = SIMD::AlignedVector<double>;
+
+    void coefficients(double sampleRate, double* hp, double* hs)
+    {
+        DSPSSOT::Helpers::calculateHighPassCoeffs(DSPSSOT::KWeighting::HIGH_PASS_FC,
+                                                  DSPSSOT::KWeighting::HIGH_PASS_Q, sampleRate, hp);
+        DSPSSOT::Helpers::calculateHighShelfCoeffs(DSPSSOT::KWeighting::HIGH_SHELF_FC,
+                                                   DSPSSOT::KWeighting::HIGH_SHELF_Q,
+                                                   DSPSSOT::KWeighting::HIGH_SHELF_GAIN_DB, sampleRate, hs);
+    }
+
+    /**
+     * Interleaved stereo test signal: tones, a DC step and deterministic noise
+     */
+    Frames makeFrames(double sampleRate, int numSamples)
+    {
+        Frames frames(static_cast<size_t>(numSamples * STRIDE), 0.0);
+        unsigned int seed = 12345;
+        for (int i = 0; i < numSamples; ++i)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            const double noise = static_cast<double>(seed >> 8) / 16777216.0 - 0.5;
+            const double t = i / sampleRate;
+            frames[static_cast<size_t>(i * STRIDE)] = 0.5 * std::sin(DSPSSOT::Math::TAU * 997.0 * t)
+                                                    + 0.2 * noise + (i > numSamples / 2 ? 0.25 : 0.0);
+            frames[static_cast<size_t>(i * STRIDE + 1)] = 0.7 * std::sin(DSPSSOT::Math::TAU * 40.0 * t)
+                                                        + 0.2 * std::sin(DSPSSOT::Math::TAU * 15000.0 * t);
+        }
+        return frames;
+    }
+
+    Frames filterWithBank(double sampleRate, Frames frames)
+    {
+        double hp[5], hs[5];
+        coefficients(sampleRate, hp, hs);
+        auto bank = std::make_unique<Bank>();
+        bank->setCoefficients(hp, hs);
+        bank->processFrames(frames.data(), STRIDE, static_cast<int>(frames.size()) / STRIDE);
+        return frames;
+    }
+
+    /**
+     * Per-sample relative error (samples within RELATIVE_FLOOR of the peak)
+     * and largest difference relative to the largest reference output
+     */
+    void expectMatchesReference(const Frames& result, const Frames& reference)
+    {
+        double peak = 0.0;
+        for (const double y : reference)
+            peak = std::max(peak, std::abs(y));
+
+        double relative = 0.0, absolute = 0.0;
+        for (size_t i = 0; i < reference.size(); ++i)
+        {
+            const double error = std::abs(result[i] - reference[i]);
+            absolute = std::max(absolute, error / peak);
+            if (std::abs(reference[i]) >= RELATIVE_FLOOR * peak)
+                relative = std::max(relative, error / std::abs(reference[i]));
+        }
+        EXPECT_LT(relative, RELATIVE_TOLERANCE);
+        EXPECT_LT(absolute, ABSOLUTE_TOLERANCE);
+    }
+}
+
+// ========================================================================
+// FILTER
+// ========================================================================
+
+/**
+ * Same response as the bank at every supported rate (both channels)
+ */
+TEST(KWeightingBlockFilterTest, MatchesBankWithinTolerance)
+{
+    for (const double rate : {44100.0, 48000.0, 96000.0, 192000.0, 384000.0})
+    {
+        SCOPED_TRACE(rate);
+        const int numSamples = static_cast<int>(rate / 2);
+        Frames frames = makeFrames(rate, numSamples);
+        const Frames reference = filterWithBank(rate, frames);
+
+        double hp[5], hs[5];
+        coefficients(rate, hp, hs);
+        auto filter = std::make_unique<BlockFilter>();
+        filter->setCoefficients(hp, hs);
+        filter->processFrames(frames.data(), STRIDE, 2, numSamples);
+
+        expectMatchesReference(frames, reference);
+    }
+}
+
+/**
+ * Uneven calls (single samples, runs shorter and longer than a block)
+ * continue the same state as one call
+ */
+TEST(KWeightingBlockFilterTest, AnySplitStaysWithinTolerance)
+{
+    constexpr double rate = 48000.0;
+    constexpr int numSamples = 20000;
+    Frames frames = makeFrames(rate, numSamples);
+    const Frames reference = filterWithBank(rate, frames);
+
+    double hp[5], hs[5];
+    coefficients(rate, hp, hs);
+    auto filter = std::make_unique<BlockFilter>();
+    filter->setCoefficients(hp, hs);
+
+    const int sizes[] = {1, 3, 7, 8, 9, 1, 64, 13, 2, 517};
+    for (int offset = 0, k = 0; offset < numSamples; ++k)
+    {
+        const int n = std::min(sizes[k % 10], numSamples - offset);
+        filter->processFrames(frames.data() + offset * STRIDE, STRIDE, 2, n);
+        offset += n;
+    }
+
+    expectMatchesReference(frames, reference);
+}
+
+/**
+ * Live state is kept; decayed state is zeroed, after which silence filters to exact zeros
+ */
+TEST(KWeightingBlockFilterTest, FlushDecayedClearsSettledState)
+{
+    double hp[5], hs[5];
+    coefficients(48000.0, hp, hs);
+    auto filter = std::make_unique<BlockFilter>();
+    filter->setCoefficients(hp, hs);
+
+    Frames frames = makeFrames(48000.0, 4800);
+    filter->processFrames(frames.data(), STRIDE, 2, 4800);
+    const auto threshold = DSPSSOT::TruePeak::DENORM_THRESHOLD;
+    EXPECT_FALSE(filter->flushDecayed(2, threshold));
+
+    // Ten seconds of silence decay every state below the threshold
+    Frames silence(static_cast<size_t>(480000 * STRIDE), 0.0);
+    filter->processFrames(silence.data(), STRIDE, 2, 480000);
+    EXPECT_TRUE(filter->flushDecayed(2, threshold));
+
+    std::fill(silence.begin(), silence.begin() + 100 * STRIDE, 0.0);
+    filter->processFrames(silence.data(), STRIDE, 2, 100);
+    for (int i = 0; i < 100 * STRIDE; ++i)
+        ASSERT_EQ(silence[static_cast<size_t>(i)], 0.0);
+}
+
+// ========================================================================
+// CORE
+// ========================================================================
+
+/**
+ * Block-parallel mode measures what the bank measures, mono and stereo,
+ * and per-sample process() continues the same filter state
+ */
+TEST(KWeightingBlockFilterTest, CoreLoudnessMatchesBank)
+{
+    constexpr double rate = 48000.0;
+    const int numSamples = static_cast<int>(rate) * 6;
+    std::vector<float> left(static_cast<size_t>(numSamples)), right(left.size());
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const double t = i / rate;
+        const double gain = (i < numSamples / 2) ? 0.3 : 0.05;
+        left[static_cast<size_t>(i)] = static_cast<float>(gain * std::sin(DSPSSOT::Math::TAU * 1000.0 * t));
+        right[static_cast<size_t>(i)] = static_cast<float>(gain * std::sin(DSPSSOT::Math::TAU * 70.0 * t));
+    }
+    // A stretch of digital silence exercises the fast path in both modes
+    std::fill(left.begin() + 100000, left.begin() + 150000, 0.0f);
+    std::fill(right.begin() + 100000, right.begin() + 150000, 0.0f);
+
+    for (const int numChannels : {1, 2})
+    {
+        SCOPED_TRACE(numChannels);
+        const float* channels[2] = {left.data(), right.data()};
+
+        auto bank = makeCore(rate, CoreOptions::withBlockParallelKWeighting(false));
+        auto blockParallel = makeCore(rate, CoreOptions::withBlockParallelKWeighting(true));
+        for (int offset = 0; offset < numSamples; offset += 1001)
+        {
+            const int n = std::min(1001, numSamples - offset);
+            const float* chunk[2] = {channels[0] + offset, channels[1] + offset};
+            bank->processBlock(chunk, numChannels, n);
+            blockParallel->processBlock(chunk, numChannels, n);
+        }
+        const MeterFrame expected = bank->getMeterFrame();
+        const MeterFrame result = blockParallel->getMeterFrame();
+
+        EXPECT_GT(expected.integratedLUFS, -30.0);
+        EXPECT_NEAR(result.integratedLUFS, expected.integratedLUFS, LUFS_TOLERANCE);
+        EXPECT_NEAR(result.momentaryLUFS, expected.momentaryLUFS, LUFS_TOLERANCE);
+        EXPECT_NEAR(result.maxMomentaryLUFS, expected.maxMomentaryLUFS, LUFS_TOLERANCE);
+        EXPECT_NEAR(result.maxShortTermLUFS, expected.maxShortTermLUFS, LUFS_TOLERANCE);
+        EXPECT_NEAR(result.loudnessRangeLU, expected.loudnessRangeLU, LUFS_TOLERANCE);
+        EXPECT_EQ(result.truePeakDB, expected.truePeakDB);
+    }
+
+    auto perSample = makeCore(rate, CoreOptions::withBlockParallelKWeighting(true));
+    for (int i = 0; i < numSamples; ++i)
+        perSample->process(left[static_cast<size_t>(i)], right[static_cast<size_t>(i)]);
+    auto bank = makeCore(rate, CoreOptions::withBlockParallelKWeighting(false));
+    bank->processBlock(left.data(), right.data(), numSamples);
+
+    EXPECT_NEAR(perSample->getMeterFrame().integratedLUFS, bank->getMeterFrame().integratedLUFS, LUFS_TOLERANCE);
+    EXPECT_NEAR(perSample->getMeterFrame().maxMomentaryLUFS, bank->getMeterFrame().maxMomentaryLUFS, LUFS_TOLERANCE);
+}
@@ -0,0 +1,300 @@
+/**
+ * @file TestLoudnessHistogram.cpp
+ * @brief Unit tests for histogram-based gated integration
+ *
+ * Tests verify:
+ * - Absolute gate rejects blocks below -70 LUFS
+ * - Two-pass relative gating matches a reference that stores every block
+ * - Blocks admitted early are re-evaluated when the relative gate rises
+ * - 400 ms gating blocks overlap by 75% (100 ms hop)
+ * - Loudness Range (EBU Tech 3342) from short-term percentiles
+ *
+ * @note Tests are designed to run without JUCE dependencies
+ */
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+#include "DSP/BULLsEYEProcessor.h"
+#include "DSP/LoudnessHistogram.h"
+#include "SSOT/DSPSSOT.h"
+#include "TestSignals.h"
+
+// ========================================================================
+// HELPER FUNCTIONS
+// ========================================================================
+
+namespace
+{
+    using TestSignals::feedTone;
+
+    constexpr double TEST_SAMPLE_RATE = 48000.0;
+
+    double lufsToEnergy(double lufs)
+    {
+        return std::pow(10.0, (lufs - DSPSSOT::GatedIntegration::K_OFFSET_DB) / 10.0);
+    }
+
+    double energyToLUFS(double energy)
+    {
+        return DSPSSOT::GatedIntegration::K_OFFSET_DB + 10.0 * std::log10(energy);
+    }
+
+    /**
+     * Reference BS.1770 two-pass gating over a full list of block energies
+     */
+    double referenceGatedLUFS(const std::vector<double>& blocks)
+    {
+        double sum = 0.0;
+        int count = 0;
+        for (double e : blocks)
+        {
+            if (energyToLUFS(e) >= DSPSSOT::GatedIntegration::GATE_ABS_DB)
+            {
+                sum += e;
+                count++;
+            }
+        }
+
+        double relativeGate = energyToLUFS(sum / count) - DSPSSOT::GatedIntegration::GATE_REL_OFFSET_DB;
+
+        sum = 0.0;
+        count = 0;
+        for (double e : blocks)
+        {
+            double l = energyToLUFS(e);
+            if (l >= DSPSSOT::GatedIntegration::GATE_ABS_DB && l >= relativeGate)
+            {
+                sum += e;
+                count++;
+            }
+        }
+
+        return energyToLUFS(sum / count);
+    }
+}
+
+// ========================================================================
+// HISTOGRAM TESTS
+// ========================================================================
+
+TEST(LoudnessHistogramTest, EmptyHistogramHasNoGatedBlocks)
+{
+    LoudnessHistogram histogram;
+
+    LoudnessHistogram::Gated gated = histogram.gatedMean(DSPSSOT::GatedIntegration::GATE_REL_ENERGY_FACTOR);
+    EXPECT_EQ(gated.count, 0);
+    EXPECT_EQ(histogram.getCount(), 0);
+}
+
+TEST(LoudnessHistogramTest, AbsoluteGateRejectsQuietBlocks)
+{
+    LoudnessHistogram histogram;
+
+    EXPECT_FALSE(histogram.add(lufsToEnergy(-80.0)));
+    EXPECT_FALSE(histogram.add(0.0));
+    EXPECT_TRUE(histogram.add(lufsToEnergy(-69.9)));
+    EXPECT_TRUE(histogram.add(lufsToEnergy(12.0)));  // Above range: clamped into top bin
+
+    EXPECT_EQ(histogram.getCount(), 2);
+}
+
+TEST(LoudnessHistogramTest, TwoPassGatingMatchesReference)
+{
+    // Deterministic spread of block loudness from -80 to 0 LUFS
+    std::vector<double> blocks;
+    LoudnessHistogram histogram;
+
+    for (int i = 0; i < 20000; i++)
+    {
+        double lufs = -80.0 + 80.0 * (((i * 7919) % 10007) / 10007.0);
+        // Mostly loud program with a quiet tail
+        if (i % 5 != 0)
+            lufs = -20.0 + 12.0 * (((i * 104729) % 997) / 997.0);
+
+        blocks.push_back(lufsToEnergy(lufs));
+        histogram.add(blocks.back());
+    }
+
+    LoudnessHistogram::Gated gated = histogram.gatedMean(DSPSSOT::GatedIntegration::GATE_REL_ENERGY_FACTOR);
+
+    // Only the bin holding the relative threshold is resolved at 0.1 LU
+    EXPECT_NEAR(energyToLUFS(gated.meanEnergy), referenceGatedLUFS(blocks), 0.05);
+}
+
+TEST(LoudnessHistogramTest, PercentileRangeOfUniformSpread)
+{
+    // Uniform spread from -40 to -20 LUFS: P95 - P10 = 0.85 * 20 LU
+    LoudnessHistogram histogram;
+    for (int i = 0; i < 20000; i++)
+        histogram.add(lufsToEnergy(-40.0 + 20.0 * (i + 0.5) / 20000.0));
+
+    EXPECT_NEAR(histogram.percentileRange(DSPSSOT::LoudnessRange::GATE_REL_ENERGY_FACTOR,
+                                          DSPSSOT::LoudnessRange::LOW_PERCENTILE,
+                                          DSPSSOT::LoudnessRange::HIGH_PERCENTILE),
+                17.0, 0.1);
+}
+
+TEST(LoudnessHistogramTest, PercentileRangeAppliesRelativeGate)
+{
+    // Two equal populations 30 LU apart: the quiet one is below the -20 LU gate
+    LoudnessHistogram histogram;
+    for (int i = 0; i < 1000; i++)
+    {
+        histogram.add(lufsToEnergy(-10.0));
+        histogram.add(lufsToEnergy(-40.0));
+    }
+
+    EXPECT_LT(histogram.percentileRange(DSPSSOT::LoudnessRange::GATE_REL_ENERGY_FACTOR,
+                                        DSPSSOT::LoudnessRange::LOW_PERCENTILE,
+                                        DSPSSOT::LoudnessRange::HIGH_PERCENTILE),
+              DSPSSOT::GatedIntegration::HISTOGRAM_BIN_WIDTH_LU);
+}
+
+TEST(LoudnessHistogramTest, MergedHalvesGateLikeOneHistogram)
+{
+    // A quiet first half and a loud second half: the relative gate of the
+    // whole program drops most of the quiet half, which neither half sees alone
+    LoudnessHistogram whole, first, second;
+    for (int i = 0; i < 4000; i++)
+    {
+        const double quiet = lufsToEnergy(-45.0 + 10.0 * ((i * 37) % 100) / 100.0);
+        const double loud = lufsToEnergy(-20.0 + 6.0 * ((i * 53) % 100) / 100.0);
+        whole.add(quiet);
+        first.add(quiet);
+        whole.add(loud);
+        second.add(loud);
+    }
+
+    first.merge(second);
+
+    const double factor = DSPSSOT::GatedIntegration::GATE_REL_ENERGY_FACTOR;
+    EXPECT_EQ(first.getCount(), whole.getCount());
+    EXPECT_EQ(first.gatedMean(factor).count, whole.gatedMean(factor).count);
+    EXPECT_NEAR(first.gatedMean(factor).meanEnergy, whole.gatedMean(factor).meanEnergy,
+                1e-12 * whole.gatedMean(factor).meanEnergy);
+    EXPECT_NEAR(first.percentileRange(DSPSSOT::LoudnessRange::GATE_REL_ENERGY_FACTOR,
+                                      DSPSSOT::LoudnessRange::LOW_PERCENTILE,
+                                      DSPSSOT::LoudnessRange::HIGH_PERCENTILE),
+                whole.percentileRange(DSPSSOT::LoudnessRange::GATE_REL_ENERGY_FACTOR,
+                                      DSPSSOT::LoudnessRange::LOW_PERCENTILE,
+                                      DSPSSOT::LoudnessRange::HIGH_PERCENTILE),
+                1e-9);
+}
+
+// ========================================================================
+// CORE GATED INTEGRATION TESTS
+// ========================================================================
+
+TEST(GatedIntegrationTest, EarlyQuietBlocksAreReGated)
+{
+    // Quiet intro (~26 dB down) followed by a loud section of equal length.
+    // Running-gate integration admits the intro forever (~3 LU low); two-pass
+    // gating drops it. Only the three partially loud transition blocks remain.
+    BULLsEYEProcessorCore quietThenLoud;
+    quietThenLoud.setSampleRate(TEST_SAMPLE_RATE);
+    feedTone(quietThenLoud, 0.025, 480000);
+    feedTone(quietThenLoud, 0.5, 480000);
+
+    BULLsEYEProcessorCore loudOnly;
+    loudOnly.setSampleRate(TEST_SAMPLE_RATE);
+    feedTone(loudOnly, 0.5, 480000);
+
+    EXPECT_NEAR(quietThenLoud.getIntegratedLUFS(), loudOnly.getIntegratedLUFS(), 0.1);
+}
+
+TEST(GatedIntegrationTest, OverlappingBlocksAdvanceEvery100ms)
+{
+    BULLsEYEProcessorCore processor;
+    processor.setSampleRate(TEST_SAMPLE_RATE);
+    feedTone(processor, 0.5, 96000);
+
+    // 2 s = 20 sub-blocks of 100 ms -> 17 overlapping 400 ms blocks (one per hop)
+    int hop = DSPSSOT::Helpers::calculateSubBlockSize(TEST_SAMPLE_RATE);
+    EXPECT_EQ(processor.getSampleSum(), 17 * hop);
+    EXPECT_EQ(processor.getTotalSamplesProcessed(), 96000);
+}
+
+TEST(GatedIntegrationTest, NoBlockBeforeFirst400ms)
+{
+    BULLsEYEProcessorCore processor;
+    processor.setSampleRate(TEST_SAMPLE_RATE);
+    feedTone(processor, 0.5, 19199);
+
+    EXPECT_DOUBLE_EQ(processor.getIntegratedLUFS(), DSPSSOT::TruePeak::MIN_DISPLAY_DB);
+
+    feedTone(processor, 0.5, 1);
+    EXPECT_GT(processor.getIntegratedLUFS(), DSPSSOT::TruePeak::MIN_DISPLAY_DB);
+}
+
+TEST(GatedIntegrationTest, ShortBurstIsCapturedByOverlap)
+{
+    // 400 ms burst starting 200 ms into the program: with back-to-back blocks it
+    // would be split in half; with 75% overlap one block contains all of it.
+    // Gated blocks hold 2/4, 3/4, 4/4, 3/4, 2/4, 1/4 of the burst energy -> mean 15/24
+    BULLsEYEProcessorCore burst;
+    burst.setSampleRate(TEST_SAMPLE_RATE);
+    feedTone(burst, 0.0, 9600);
+    feedTone(burst, 0.5, 19200);
+    feedTone(burst, 0.0, 48000);
+
+    BULLsEYEProcessorCore steady;
+    steady.setSampleRate(TEST_SAMPLE_RATE);
+    feedTone(steady, 0.5, 96000);
+
+    EXPECT_NEAR(burst.getIntegratedLUFS() - steady.getIntegratedLUFS(), 10.0 * std::log10(15.0 / 24.0), 0.05);
+}
+
+// ========================================================================
+// LOUDNESS RANGE TESTS (EBU Tech 3342 test signals, tolerance +/-1 LU)
+// ========================================================================
+
+namespace
+{
+    /**
+     * Feed 20 s 1 kHz stereo tone sections at the given levels (dB relative to -20)
+     * and return LRA
+     */
+    double measureLRA(std::initializer_list<double> sectionLevelsDB)
+    {
+        BULLsEYEProcessorCore processor;
+        processor.setSampleRate(TEST_SAMPLE_RATE);
+
+        for (double levelDB : sectionLevelsDB)
+            feedTone(processor, 0.1 * std::pow(10.0, levelDB / 20.0), 20 * static_cast<int>(TEST_SAMPLE_RATE));
+
+        return processor.getLoudnessRangeLU();
+    }
+}
+
+TEST(LoudnessRangeTest, EBU3342Case1)
+{
+    EXPECT_NEAR(measureLRA({0.0, -10.0}), 10.0, 1.0);
+}
+
+TEST(LoudnessRangeTest, EBU3342Case2)
+{
+    EXPECT_NEAR(measureLRA({0.0, 5.0}), 5.0, 1.0);
+}
+
+TEST(LoudnessRangeTest, EBU3342Case3)
+{
+    EXPECT_NEAR(measureLRA({-20.0, 0.0}), 20.0, 1.0);
+}
+
+TEST(LoudnessRangeTest, EBU3342Case4)
+{
+    EXPECT_NEAR(measureLRA({-30.0, -15.0, 0.0, -15.0, -30.0}), 15.0, 1.0);
+}
+
+TEST(LoudnessRangeTest, SteadyToneHasNoRange)
+{
+    BULLsEYEProcessorCore processor;
+    processor.setSampleRate(TEST_SAMPLE_RATE);
+    feedTone(processor, 0.5, 480000);
+
+    EXPECT_LT(processor.getLoudnessRangeLU(), DSPSSOT::GatedIntegration::HISTOGRAM_BIN_WIDTH_LU);
+
+    processor.reset();
+    EXPECT_DOUBLE_EQ(processor.getLoudnessRangeLU(), 0.0);
+}
@@ -0,0 +1,317 @@
+/**
+ * @file TestLoudnessHistory.cpp
+ * @brief Unit tests for the SPSC loudness history stream
+ *
+ * Tests verify:
+ * - SPSC ring ordering, overflow (drop newest) and drop counting
+ * - No element is lost or reordered under a concurrent producer / consumer
+ * - Capacity changes reallocate, and clear() discards, without writing the
+ *   consumer index or freeing storage under a read, so both are safe while
+ *   the reader drains
+ * - The core pushes one record per 100 ms hop with correct peaks and gate flag
+ * - Records are kept up to capacity while nobody drains
+ *
+ * @note Tests are designed to run without JUCE dependencies
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "DSP/BULLsEYEProcessor.h"
+#include "DSP/LoudnessHistory.h"
+#include "DSP/SPSCRing.h"
+#include "SSOT/DSPSSOT.h"
+#include "SSOT/ProcessorSSOT.h"
+#include "TestSignals.h"
+
+// ========================================================================
+// HELPER FUNCTIONS
+// ========================================================================
+
+namespace
+{
+    using TestSignals::feedBlocks;
+    using TestSignals::makeTone;
+
+    constexpr double TEST_SAMPLE_RATE = 48000.0;
+
+    std::vector<LoudnessHopRecord> drainAll(BULLsEYEProcessorCore& processor)
+    {
+        std::vector<LoudnessHopRecord> records;
+        processor.drainHistory([&](const LoudnessHopRecord& r) { records.push_back(r); });
+        return records;
+    }
+}
+
+// ========================================================================
+// SPSC RING TESTS
+// ========================================================================
+
+TEST(SPSCRingTest, KeepsOrderAndDropsNewestWhenFull)
+{
+    SPSCRing<int> ring;
+    ring.setCapacity(4);
+
+    for (int i = 0; i < 6; i++)
+        ring.push(i);
+
+    EXPECT_EQ(ring.size(), 4u);
+    EXPECT_EQ(ring.getDroppedCount(), 2u);
+
+    int value = -1;
+    for (int expected = 0; expected < 4; expected++)
+    {
+        ASSERT_TRUE(ring.pop(value));
+        EXPECT_EQ(value, expected);
+    }
+    EXPECT_FALSE(ring.pop(value));
+
+    // Space freed by the reader is reused
+    EXPECT_TRUE(ring.push(42));
+    std::vector<int> drained;
+    EXPECT_EQ(ring.drain([&](int v) { drained.push_back(v); }), 1u);
+    EXPECT_EQ(drained, std::vector<int>{42});
+}
+
+TEST(SPSCRingTest, ZeroCapacityDropsEverything)
+{
+    SPSCRing<int> ring;
+    EXPECT_FALSE(ring.push(1));
+    EXPECT_EQ(ring.getDroppedCount(), 1u);
+
+    int value = 0;
+    EXPECT_FALSE(ring.pop(value));
+}
+
+TEST(SPSCRingTest, ConcurrentProducerConsumerLosesNothing)
+{
+    SPSCRing<std::uint64_t> ring;
+    ring.setCapacity(1024);
+    constexpr std::uint64_t NUM_ELEMENTS = 200000;
+
+    std::thread producer([&]
+    {
+        for (std::uint64_t i = 0; i < NUM_ELEMENTS; i++)
+            while (!ring.push(i))
+                std::this_thread::yield();
+    });
+
+    std::uint64_t expected = 0;
+    bool ordered = true;
+    while (expected < NUM_ELEMENTS)
+    {
+        const std::size_t n = ring.drain([&](std::uint64_t v)
+        {
+            ordered = ordered && (v == expected);
+            expected++;
+        });
+        if (n == 0)
+            std::this_thread::yield();
+    }
+
+    producer.join();
+
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(expected, NUM_ELEMENTS);
+}
+
+TEST(SPSCRingTest, ClearAndCapacityChangesDiscardQueued)
+{
+    SPSCRing<int> ring;
+    ring.setCapacity(3);
+    EXPECT_EQ(ring.getCapacity(), 3u);
+    for (int i = 0; i < 5; i++)
+        ring.push(i);
+    EXPECT_EQ(ring.size(), 3u);
+    EXPECT_EQ(ring.getDroppedCount(), 2u);
+
+    // Cleared elements are skipped by the reader; the drop count restarts
+    ring.clear();
+    EXPECT_EQ(ring.size(), 0u);
+    EXPECT_EQ(ring.getDroppedCount(), 0u);
+    EXPECT_TRUE(ring.push(10));
+    EXPECT_TRUE(ring.push(11));
+
+    std::vector<int> drained;
+    ring.drain([&](int v) { drained.push_back(v); });
+    EXPECT_EQ(drained, (std::vector<int>{10, 11}));
+
+    // A new capacity gets new storage and discards what was queued
+    EXPECT_TRUE(ring.push(12));
+    ring.setCapacity(8);
+    EXPECT_EQ(ring.getCapacity(), 8u);
+    EXPECT_EQ(ring.size(), 0u);
+    for (int i = 0; i < 8; i++)
+        EXPECT_TRUE(ring.push(i));
+    EXPECT_FALSE(ring.push(8));
+
+    // Nobody drains (editor closed): cleared slots are reused all the same
+    ring.clear();
+    for (int i = 20; i < 28; i++)
+        EXPECT_TRUE(ring.push(i));
+    drained.clear();
+    EXPECT_EQ(ring.drain([&](int v) { drained.push_back(v); }), 8u);
+    EXPECT_EQ(drained, (std::vector<int>{20, 21, 22, 23, 24, 25, 26, 27}));
+
+    // Zero capacity frees the storage and drops everything
+    ring.setCapacity(0);
+    EXPECT_FALSE(ring.push(1));
+    int value = 0;
+    EXPECT_FALSE(ring.pop(value));
+}
+
+TEST(SPSCRingTest, ClearWhileDrainingKeepsReaderConsistent)
+{
+    // prepareToPlay may reallocate / clear the stream while the editor drains it
+    SPSCRing<std::uint64_t> ring;
+    ring.setCapacity(256);
+    constexpr std::uint64_t NUM_ELEMENTS = 200000;
+    std::atomic<bool> done{false};
+
+    std::thread producer([&]
+    {
+        for (std::uint64_t i = 0; i < NUM_ELEMENTS; i++)
+        {
+            if (i % 1000 == 999)
+                ring.setCapacity((i / 1000) % 2 == 0 ? 16 : 256);
+            ring.push(i);
+        }
+        done.store(true, std::memory_order_release);
+    });
+
+    // Whatever survives a clear arrives in order and was really pushed
+    std::uint64_t previous = 0;
+    std::uint64_t received = 0;
+    bool ordered = true;
+    bool finished = false;
+    while (!finished)
+    {
+        finished = done.load(std::memory_order_acquire);
+        ring.drain([&](std::uint64_t v)
+        {
+            ordered = ordered && (received == 0 || v > previous) && v < NUM_ELEMENTS;
+            previous = v;
+            received++;
+        });
+        std::this_thread::yield();
+    }
+
+    producer.join();
+
+    EXPECT_TRUE(ordered);
+    EXPECT_GT(received, 0u);
+    EXPECT_EQ(ring.size(), 0u);
+}
+
+// ========================================================================
+// CORE HISTORY STREAM TESTS
+// ========================================================================
+
+TEST(LoudnessHistoryTest, OneRecordPerHop)
+{
+    BULLsEYEProcessorCore processor;
+    processor.setSampleRate(TEST_SAMPLE_RATE);
+    processor.setHistoryCapacity(ProcessorSSOT::History::capacityForSeconds(60.0));
+
+    feedBlocks(processor, makeTone(0.5, 48000 * 3), 512);
+
+    const int hop = DSPSSOT::Helpers::calculateSubBlockSize(TEST_SAMPLE_RATE);
+    std::vector<LoudnessHopRecord> records = drainAll(processor);
+    ASSERT_EQ(records.size(), 30u);
+
+    for (size_t i = 0; i < records.size(); i++)
+    {
+        EXPECT_EQ(records[i].samplePosition, static_cast<std::int64_t>((i + 1) * hop));
+        // First gating block closes at the 4th hop
+        EXPECT_EQ(records[i].gated, i >= 3) << i;
+        EXPECT_NEAR(records[i].samplePeak, 0.5, 1e-3);
+        EXPECT_GE(records[i].truePeak, records[i].samplePeak * 0.999f);
+    }
+
+    // Steady tone: full-window momentary energy matches the published momentary loudness
+    const double lufs = DSPSSOT::GatedIntegration::K_OFFSET_DB
+                      + 10.0 * std::log10(records.back().momentaryEnergy)
+                      + DSPSSOT::GatedIntegration::JSFX_CALIBRATION_OFFSET_DB;
+    EXPECT_NEAR(lufs, processor.getMomentaryLUFS(), 1e-9);
+
+    // Drained records are gone
+    EXPECT_TRUE(drainAll(processor).empty());
+}
+
+TEST(LoudnessHistoryTest, PeaksBelongToTheirHop)
+{
+    BULLsEYEProcessorCore processor;
+    processor.setSampleRate(TEST_SAMPLE_RATE);
+    processor.setHistoryCapacity(100);
+
+    // Quiet second, one loud click in the middle of hop 5 (samples 24000..28799)
+    std::vector<float> buffer = makeTone(0.01, 48000);
+    buffer[26000] = 0.9f;
+    feedBlocks(processor, buffer, 480);
+
+    std::vector<LoudnessHopRecord> records = drainAll(processor);
+    ASSERT_EQ(records.size(), 10u);
+    for (size_t i = 0; i < records.size(); i++)
+    {
+        if (i == 5)
+        {
+            EXPECT_NEAR(records[i].samplePeak, 0.9, 1e-6);
+            EXPECT_GE(records[i].truePeak, 0.9f);
+        }
+        else
+        {
+            // True Peak below the running peak is an upper estimate (True Peak
+            // early out): at most the FIR's L1 norm (~2x) above the hop's level
+            EXPECT_LT(records[i].samplePeak, 0.02f) << i;
+            EXPECT_LT(records[i].truePeak, 0.05f) << i;
+        }
+    }
+}
+
+TEST(LoudnessHistoryTest, UndrainedStreamKeepsOldestUpToCapacity)
+{
+    BULLsEYEProcessorCore processor;
+    processor.setSampleRate(TEST_SAMPLE_RATE);
+    processor.setHistoryCapacity(10);
+
+    feedBlocks(processor, makeTone(0.5, 48000 * 2), 512);
+
+    std::vector<LoudnessHopRecord> records = drainAll(processor);
+    ASSERT_EQ(records.size(), 10u);
+    EXPECT_EQ(records.front().samplePosition, DSPSSOT::Helpers::calculateSubBlockSize(TEST_SAMPLE_RATE));
+    EXPECT_EQ(processor.getHistoryDroppedCount(), 10u);
+}
+
+TEST(LoudnessHistoryTest, PerSampleAndBlockPathsPushIdenticalRecords)
+{
+    BULLsEYEProcessorCore perSample;
+    BULLsEYEProcessorCore block;
+    for (BULLsEYEProcessorCore* p : {&perSample, &block})
+    {
+        p->setSampleRate(TEST_SAMPLE_RATE);
+        p->setHistoryCapacity(100);
+    }
+
+    std::vector<float> buffer = makeTone(0.3, 48000);
+    for (float sample : buffer)
+    {
+        float l = sample, r = sample;
+        perSample.process(l, r);
+    }
+    feedBlocks(block, buffer, 333);
+
+    std::vector<LoudnessHopRecord> a = drainAll(perSample);
+    std::vector<LoudnessHopRecord> b = drainAll(block);
+    ASSERT_EQ(a.size(), b.size());
+    for (size_t i = 0; i < a.size(); i++)
+    {
+        EXPECT_EQ(a[i].samplePosition, b[i].samplePosition);
+        EXPECT_EQ(a[i].momentaryEnergy, b[i].momentaryEnergy);
+        EXPECT_EQ(a[i].samplePeak, b[i].samplePeak);
+        EXPECT_EQ(a[i].truePeak, b[i].truePeak);
+        EXPECT_EQ(a[i].gated, b[i].gated);
+    }
+}
@@ -0,0 +1,144 @@
+/**
+ * @file TestLoudnessTimeline.cpp
+ * @brief Unit tests for the mipmapped loudness timeline
+ *
+ * Tests verify:
+ * - Recent history renders at full (100 ms) resolution
+ * - Columns aggregate min / max and energy-domain mean
+ * - Old history is kept at coarser levels (bounded memory)
+ * - Spans longer than the session render as empty columns
+ *
+ * @note Tests are designed to run without JUCE dependencies
+ */
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+#include "DSP/LoudnessTimeline.h"
+#include "SSOT/DSPSSOT.h"
+
+// ========================================================================
+// HELPER FUNCTIONS
+// ========================================================================
+
+namespace
+{
+    LoudnessHopRecord makeRecord(double energy, float truePeak = 0.5f)
+    {
+        LoudnessHopRecord record;
+        record.momentaryEnergy = energy;
+        record.samplePeak = truePeak;
+        record.truePeak = truePeak;
+        record.gated = true;
+        return record;
+    }
+
+    float lufs(double energy)
+    {
+        return static_cast<float>(DSPSSOT::Helpers::energyToDisplayLUFS(energy));
+    }
+}
+
+// ========================================================================
+// TIMELINE TESTS
+// ========================================================================
+
+TEST(LoudnessTimelineTest, RecentHistoryAtFullResolution)
+{
+    LoudnessTimeline timeline;
+    for (int i = 0; i < 100; i++)
+        timeline.addFrame(makeRecord(0.001 * (i + 1)));
+
+    std::vector<LoudnessTimeline::Column> columns(100);
+    timeline.render(100, columns.data(), 100);
+
+    EXPECT_EQ(timeline.levelFor(100, 100, 0), 0);
+    for (int i = 0; i < 100; i++)
+    {
+        ASSERT_TRUE(columns[i].valid) << i;
+        EXPECT_FLOAT_EQ(columns[i].minLUFS, lufs(0.001 * (i + 1)));
+        EXPECT_FLOAT_EQ(columns[i].maxLUFS, columns[i].minLUFS);
+        EXPECT_NEAR(columns[i].meanLUFS, columns[i].minLUFS, 1e-4);
+    }
+}
+
+TEST(LoudnessTimelineTest, ColumnsAggregateMinMaxAndEnergyMean)
+{
+    LoudnessTimeline timeline;
+    for (int i = 0; i < 1024; i++)
+        timeline.addFrame(makeRecord((i % 2 == 0) ? 0.01 : 0.0001, (i == 700) ? 0.9f : 0.1f));
+
+    std::vector<LoudnessTimeline::Column> columns(8);
+    timeline.render(1024, columns.data(), 8);
+
+    for (const auto& column : columns)
+    {
+        ASSERT_TRUE(column.valid);
+        EXPECT_FLOAT_EQ(column.minLUFS, lufs(0.0001));
+        EXPECT_FLOAT_EQ(column.maxLUFS, lufs(0.01));
+        // Mean is taken in the energy domain, not as the mean of LUFS values
+        EXPECT_NEAR(column.meanLUFS, lufs(0.00505), 1e-3);
+    }
+
+    // Frame 700 falls in column 5 (frames 640..767)
+    EXPECT_NEAR(columns[5].truePeakDB, 20.0 * std::log10(0.9), 1e-4);
+    EXPECT_NEAR(columns[4].truePeakDB, 20.0 * std::log10(0.1), 1e-4);
+}
+
+TEST(LoudnessTimelineTest, OldHistoryKeptAtCoarserLevels)
+{
+    LoudnessTimeline timeline;
+    constexpr int NUM_FRAMES = 200000;   // ~5.5 hours of 100 ms frames
+    for (int i = 0; i < NUM_FRAMES; i++)
+        timeline.addFrame(makeRecord((i < NUM_FRAMES / 2) ? 0.01 : 0.0001));
+
+    // 3 hours across 300 columns: ~360 frames per column, served from the top levels
+    constexpr std::int64_t THREE_HOURS = 108000;
+    std::vector<LoudnessTimeline::Column> columns(300);
+    timeline.render(THREE_HOURS, columns.data(), 300);
+
+    for (const auto& column : columns)
+        ASSERT_TRUE(column.valid);
+    EXPECT_GE(timeline.levelFor(THREE_HOURS, 300, NUM_FRAMES - THREE_HOURS), 6);
+
+    // 3 hours across many columns: level 0 no longer covers the span
+    EXPECT_GT(timeline.levelFor(THREE_HOURS, 20000, NUM_FRAMES - THREE_HOURS), 0);
+
+    // The step at the half-way point is still visible in the 3 hour view
+    EXPECT_FLOAT_EQ(columns.front().maxLUFS, lufs(0.01));
+    EXPECT_FLOAT_EQ(columns.back().maxLUFS, lufs(0.0001));
+
+    // The last 10 seconds are still at full resolution
+    EXPECT_EQ(timeline.levelFor(100, 100, NUM_FRAMES - 100), 0);
+}
+
+TEST(LoudnessTimelineTest, SpanLongerThanSessionLeavesEmptyColumns)
+{
+    LoudnessTimeline timeline;
+    for (int i = 0; i < 50; i++)
+        timeline.addFrame(makeRecord(0.01));
+
+    std::vector<LoudnessTimeline::Column> columns(100);
+    timeline.render(100, columns.data(), 100);
+
+    for (int i = 0; i < 100; i++)
+        EXPECT_EQ(columns[i].valid, i >= 50) << i;
+
+    timeline.clear();
+    timeline.render(100, columns.data(), 100);
+    for (const auto& column : columns)
+        EXPECT_FALSE(column.valid);
+}
+
+TEST(LoudnessTimelineTest, SilentFramesReadAtDisplayFloor)
+{
+    LoudnessTimeline timeline;
+    timeline.addFrame(makeRecord(0.0, 0.0f));
+
+    LoudnessTimeline::Column column;
+    timeline.render(1, &column, 1);
+
+    ASSERT_TRUE(column.valid);
+    EXPECT_FLOAT_EQ(column.minLUFS, static_cast<float>(DSPSSOT::TruePeak::MIN_DISPLAY_DB));
+    EXPECT_FLOAT_EQ(column.truePeakDB, static_cast<float>(DSPSSOT::TruePeak::MIN_DISPLAY_DB));
+}
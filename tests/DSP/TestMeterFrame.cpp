@@ -0,0 +1,181 @@
+/**
+ * @file TestMeterFrame.cpp
+ * @brief Unit tests for seqlocked meter frame publication
+ *
+ * Tests verify:
+ * - Readers never observe a torn frame while the writer publishes
+ * - Deviation in a frame always matches the frame's content type
+ * - Frames carry a sample-position timestamp
+ * - Linear levels convert to the display values (floor, clamps, deviation)
+ *
+ * @note Tests are designed to run without JUCE dependencies
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cmath>
+#include <thread>
+#include <vector>
+#include "DSP/BULLsEYEProcessor.h"
+#include "DSP/MeterFrame.h"
+#include "SSOT/DSPSSOT.h"
+#include "SSOT/ModelSSOT.h"
+#include "TestSignals.h"
+
+// ========================================================================
+// HELPER FUNCTIONS
+// ========================================================================
+
+namespace
+{
+    using TestSignals::feedTone;
+
+    constexpr double TEST_SAMPLE_RATE = 48000.0;
+
+    /**
+     * Levels whose every field is derived from one publication index
+     */
+    MeterLevels makeLevels(std::int64_t index)
+    {
+        MeterLevels levels;
+        const double v = static_cast<double>(index);
+        levels.integratedEnergy = v;
+        levels.truePeak = v;
+        levels.momentaryEnergy = v;
+        levels.shortTermEnergy = v;
+        levels.maxMomentaryEnergy = v;
+        levels.maxShortTermEnergy = v;
+        levels.loudnessRangeLU = v;
+        levels.sampleSum = index;
+        levels.totalSamplesProcessed = index;
+        levels.samplePosition = index;
+        return levels;
+    }
+
+    bool isConsistent(const MeterFrame& frame)
+    {
+        const MeterFrame expected = makeLevels(frame.samplePosition).toFrame();
+        return frame.integratedLUFS == expected.integratedLUFS && frame.truePeakDB == expected.truePeakDB
+            && frame.deviationLU == expected.deviationLU
+            && frame.momentaryLUFS == expected.momentaryLUFS && frame.shortTermLUFS == expected.shortTermLUFS
+            && frame.maxMomentaryLUFS == expected.maxMomentaryLUFS && frame.maxShortTermLUFS == expected.maxShortTermLUFS
+            && frame.loudnessRangeLU == expected.loudnessRangeLU
+            && frame.sampleSum == frame.samplePosition
+            && frame.totalSamplesProcessed == frame.samplePosition;
+    }
+}
+
+// ========================================================================
+// SEQLOCK TESTS
+// ========================================================================
+
+TEST(MeterFrameTest, DefaultFrameIsAtFloor)
+{
+    MeterFrameSeqlock seqlock;
+    MeterFrame frame = seqlock.read();
+
+    EXPECT_DOUBLE_EQ(frame.integratedLUFS, DSPSSOT::TruePeak::MIN_DISPLAY_DB);
+    EXPECT_DOUBLE_EQ(frame.truePeakDB, DSPSSOT::TruePeak::MIN_DISPLAY_DB);
+    EXPECT_EQ(frame.samplePosition, 0);
+    EXPECT_EQ(seqlock.getPublishCount(), 0u);
+}
+
+TEST(MeterFrameTest, ReaderNeverSeesTornFrame)
+{
+    MeterFrameSeqlock seqlock;
+    std::atomic<bool> done{false};
+    constexpr std::int64_t NUM_WRITES = 200000;
+
+    std::thread writer([&]
+    {
+        for (std::int64_t i = 1; i <= NUM_WRITES; i++)
+            seqlock.write(makeLevels(i));
+        done.store(true);
+    });
+
+    std::int64_t reads = 0;
+    std::int64_t torn = 0;
+    std::int64_t lastPosition = 0;
+    bool monotonic = true;
+
+    while (!done.load())
+    {
+        MeterFrame frame = seqlock.read();
+        if (frame.samplePosition > 0 && !isConsistent(frame))
+            torn++;
+        if (frame.samplePosition < lastPosition)
+            monotonic = false;
+        lastPosition = frame.samplePosition;
+        reads++;
+    }
+
+    writer.join();
+
+    EXPECT_GT(reads, 0);
+    EXPECT_EQ(torn, 0);
+    EXPECT_TRUE(monotonic);
+    EXPECT_EQ(seqlock.read().samplePosition, NUM_WRITES);
+}
+
+/**
+ * Readers convert published linear levels exactly as the display helpers do
+ */
+TEST(MeterFrameTest, LevelsConvertToDisplayUnits)
+{
+    const MeterFrame floor = MeterLevels{}.toFrame();
+    const MeterFrame defaults;
+    EXPECT_EQ(floor.integratedLUFS, defaults.integratedLUFS);
+    EXPECT_EQ(floor.truePeakDB, defaults.truePeakDB);
+    EXPECT_EQ(floor.deviationLU, defaults.deviationLU);
+    EXPECT_EQ(floor.maxShortTermLUFS, defaults.maxShortTermLUFS);
+
+    MeterLevels levels;
+    levels.integratedEnergy = 0.01;
+    levels.truePeak = 0.5;
+    levels.sampleSum = 4800;
+    levels.contentType = ModelSSOT::ContentType::CinemaTrailer;
+    const MeterFrame frame = levels.toFrame();
+    EXPECT_EQ(frame.integratedLUFS, DSPSSOT::Helpers::energyToDisplayLUFS(0.01));
+    EXPECT_NEAR(frame.truePeakDB, -6.0206, 1e-4);
+    EXPECT_EQ(frame.deviationLU, frame.integratedLUFS - ModelSSOT::Helpers::getTargetLUFS(levels.contentType));
+
+    // Invalid and out-of-range peaks read as the display limits
+    EXPECT_EQ(DSPSSOT::Helpers::truePeakToDisplayDB(std::nan("")), DSPSSOT::TruePeak::MIN_DISPLAY_DB);
+    EXPECT_EQ(DSPSSOT::Helpers::truePeakToDisplayDB(INFINITY), DSPSSOT::TruePeak::MIN_DISPLAY_DB);
+    EXPECT_EQ(DSPSSOT::Helpers::truePeakToDisplayDB(1e-30), DSPSSOT::TruePeak::MIN_DISPLAY_DB);
+    EXPECT_EQ(DSPSSOT::Helpers::truePeakToDisplayDB(1e6), DSPSSOT::TruePeak::MAX_DISPLAY_DB);
+}
+
+// ========================================================================
+// CORE PUBLICATION TESTS
+// ========================================================================
+
+TEST(MeterFrameTest, DeviationMatchesFrameContentType)
+{
+    BULLsEYEProcessorCore processor;
+    processor.setSampleRate(TEST_SAMPLE_RATE);
+    feedTone(processor, 0.5, 96000);
+
+    // Switching content type is picked up at the next publication
+    processor.setContentType(ModelSSOT::ContentType::CinemaTrailer);
+    feedTone(processor, 0.5, 512);
+
+    MeterFrame frame = processor.getMeterFrame();
+    EXPECT_EQ(frame.contentType, ModelSSOT::ContentType::CinemaTrailer);
+    EXPECT_NEAR(frame.deviationLU,
+                frame.integratedLUFS - ModelSSOT::Helpers::getTargetLUFS(frame.contentType), 1e-12);
+}
+
+TEST(MeterFrameTest, FrameCarriesSamplePosition)
+{
+    BULLsEYEProcessorCore processor;
+    processor.setSampleRate(TEST_SAMPLE_RATE);
+    feedTone(processor, 0.5, 10000);
+
+    MeterFrame frame = processor.getMeterFrame();
+    EXPECT_EQ(frame.samplePosition, 10000);
+    EXPECT_EQ(frame.totalSamplesProcessed, 2 * DSPSSOT::Helpers::calculateSubBlockSize(TEST_SAMPLE_RATE));
+
+    processor.reset();
+    EXPECT_EQ(processor.getMeterFrame().samplePosition, 0);
+}
@@ -0,0 +1,345 @@
+/**
+ * @file TestPrecisionPolicy.cpp
+ * @brief Accuracy of the reduced-precision DSP core variants
+ *
+ * Tests verify:
+ * - Float filters keep their lanes bit-identical to scalar float biquads
+ * - FloatFilter (float biquads, double sums) stays within 0.05 LU of the
+ *   double reference on a synthetic corpus at 44.1 - 192 kHz
+ * - Float (float throughout) stays within its documented bound
+ * - True Peak is unaffected by the policy (always computed in double)
+ *
+ * The corpus report (worst error per signal, rate and metric) is printed
+ * with the test output.
+ *
+ * @note Tests are designed to run without JUCE dependencies
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "DSP/BULLsEYEProcessor.h"
+#include "DSP/PrecisionPolicy.h"
+#include "SSOT/DSPSSOT.h"
+
+// ========================================================================
+// CORPUS
+// ========================================================================
+
+namespace
+{
+    constexpr double CORPUS_SECONDS = 4.0;
+    constexpr int CHUNK_FRAMES = 512;
+    constexpr double CORPUS_RATES[] = {44100.0, 48000.0, 96000.0, 192000.0};
+
+    // Acceptance bounds (LU, against the double reference)
+    constexpr double FLOAT_FILTER_MAX_ERROR_LU = 0.05;
+    constexpr double FLOAT_MAX_ERROR_LU = 0.1;
+
+    struct Signal
+    {
+        std::string name;
+        std::vector<std::vector<float>> channels;
+        std::vector<double> weights;
+    };
+
+    double dbToGain(double db) { return std::pow(10.0, db / 20.0); }
+
+    /**
+     * Deterministic synthetic programme material, one entry per character
+     * the meter sees in practice (broadband, tonal, quiet, transient, LF, surround)
+     */
+    std::vector<Signal> makeCorpus(double sampleRate)
+    {
+        const int n = static_cast<int>(CORPUS_SECONDS * sampleRate);
+        std::mt19937 rng(1770);
+        std::normal_distribution<double> gauss(0.0, 1.0);
+
+        auto blank = [n](const std::string& name, int numChannels) {
+            Signal s;
+            s.name = name;
+            s.channels.assign(static_cast<size_t>(numChannels), std::vector<float>(static_cast<size_t>(n)));
+            s.weights.assign(static_cast<size_t>(numChannels), DSPSSOT::ChannelWeighting::FRONT);
+            return s;
+        };
+
+        // Pink-ish noise (white noise through a one-pole low-pass) at a given level
+        auto noise = [&](std::vector<float>& out, double db) {
+            double lp = 0.0;
+            for (auto& x : out)
+            {
+                lp += 0.1 * (gauss(rng) - lp);
+                x = static_cast<float>(dbToGain(db) * 3.0 * lp);
+            }
+        };
+
+        auto sine = [&](std::vector<float>& out, double freq, double db) {
+            for (size_t i = 0; i < out.size(); ++i)
+                out[i] = static_cast<float>(dbToGain(db) * std::sin(DSPSSOT::Math::TAU * freq * static_cast<double>(i) / sampleRate));
+        };
+
+        std::vector<Signal> corpus;
+
+        Signal broadband = blank("noise -20 dBFS", 2);
+        for (auto& ch : broadband.channels)
+            noise(ch, -20.0);
+        corpus.push_back(std::move(broadband));
+
+        Signal tone = blank("sine 1 kHz -6 dBFS", 2);
+        for (auto& ch : tone.channels)
+            sine(ch, 997.0, -6.0);
+        corpus.push_back(std::move(tone));
+
+        Signal bass = blank("sine 40 Hz -12 dBFS", 2);
+        for (auto& ch : bass.channels)
+            sine(ch, 40.0, -12.0);
+        corpus.push_back(std::move(bass));
+
+        Signal quiet = blank("noise -60 dBFS", 2);
+        for (auto& ch : quiet.channels)
+            noise(ch, -60.0);
+        corpus.push_back(std::move(quiet));
+
+        // Kick-like bursts every 250 ms: 55 Hz with a 60 ms decay over a -40 dBFS bed
+        Signal drums = blank("drums", 2);
+        for (auto& ch : drums.channels)
+        {
+            noise(ch, -40.0);
+            const int period = static_cast<int>(0.25 * sampleRate);
+            for (int i = 0; i < n; ++i)
+            {
+                const double t = static_cast<double>(i % period) / sampleRate;
+                ch[static_cast<size_t>(i)] += static_cast<float>(
+                    0.8 * std::exp(-t / 0.06) * std::sin(DSPSSOT::Math::TAU * 55.0 * t));
+            }
+        }
+        corpus.push_back(std::move(drums));
+
+        // Level steps for a non-trivial LRA: -10 / -30 dBFS every second
+        Signal steps = blank("noise steps -10/-30", 2);
+        for (auto& ch : steps.channels)
+        {
+            noise(ch, 0.0);
+            const int step = static_cast<int>(sampleRate);
+            for (int i = 0; i < n; ++i)
+                ch[static_cast<size_t>(i)] *= static_cast<float>(dbToGain((i / step) % 2 == 0 ? -10.0 : -30.0));
+        }
+        corpus.push_back(std::move(steps));
+
+        // 5.1 (L R C LFE Ls Rs) with BS.1770 weights
+        Signal surround = blank("5.1 noise -24 dBFS", 6);
+        surround.weights = {DSPSSOT::ChannelWeighting::FRONT, DSPSSOT::ChannelWeighting::FRONT,
+                            DSPSSOT::ChannelWeighting::FRONT, DSPSSOT::ChannelWeighting::LFE,
+                            DSPSSOT::ChannelWeighting::SURROUND, DSPSSOT::ChannelWeighting::SURROUND};
+        for (auto& ch : surround.channels)
+            noise(ch, -24.0);
+        corpus.push_back(std::move(surround));
+
+        return corpus;
+    }
+
+    struct Measurement
+    {
+        double integrated;
+        double maxMomentary;
+        double maxShortTerm;
+        double loudnessRange;
+        double truePeak;
+    };
+
+    template<typename Policy>
+    Measurement measure(const Signal& signal, double sampleRate)
+    {
+        auto core = std::make_unique<BasicBULLsEYEProcessorCore<Policy>>();
+        core->setSampleRate(sampleRate);
+        core->setChannelWeights(signal.weights.data(), static_cast<int>(signal.weights.size()));
+        core->reset();
+
+        const int numChannels = static_cast<int>(signal.channels.size());
+        const int numSamples = static_cast<int>(signal.channels[0].size());
+        std::vector<const float*> pointers(static_cast<size_t>(numChannels));
+
+        for (int offset = 0; offset < numSamples; offset += CHUNK_FRAMES)
+        {
+            for (int ch = 0; ch < numChannels; ++ch)
+                pointers[static_cast<size_t>(ch)] = signal.channels[static_cast<size_t>(ch)].data() + offset;
+            core->processBlock(pointers.data(), numChannels, std::min(CHUNK_FRAMES, numSamples - offset));
+        }
+
+        const MeterFrame frame = core->getMeterFrame();
+        return {frame.integratedLUFS, frame.maxMomentaryLUFS, frame.maxShortTermLUFS,
+                frame.loudnessRangeLU, frame.truePeakDB};
+    }
+
+    struct Errors
+    {
+        double integrated{0.0};
+        double maxMomentary{0.0};
+        double maxShortTerm{0.0};
+        double loudnessRange{0.0};
+        double truePeak{0.0};
+
+        double worstLoudness() const { return std::max({integrated, maxMomentary, maxShortTerm, loudnessRange}); }
+
+        void include(const Errors& other)
+        {
+            integrated = std::max(integrated, other.integrated);
+            maxMomentary = std::max(maxMomentary, other.maxMomentary);
+            maxShortTerm = std::max(maxShortTerm, other.maxShortTerm);
+            loudnessRange = std::max(loudnessRange, other.loudnessRange);
+            truePeak = std::max(truePeak, other.truePeak);
+        }
+    };
+
+    Errors difference(const Measurement& a, const Measurement& reference)
+    {
+        return {std::abs(a.integrated - reference.integrated), std::abs(a.maxMomentary - reference.maxMomentary),
+                std::abs(a.maxShortTerm - reference.maxShortTerm), std::abs(a.loudnessRange - reference.loudnessRange),
+                std::abs(a.truePeak - reference.truePeak)};
+    }
+
+    struct CorpusReport
+    {
+        Errors floatFilter;
+        Errors floatThroughout;
+    };
+
+    /**
+     * Run the whole corpus through every policy and print the error table
+     */
+    const CorpusReport& corpusReport()
+    {
+        static const CorpusReport report = [] {
+            CorpusReport r;
+            char line[160];
+            std::cout << "[ PRECISION] max |error| vs double (LU; I / M max / S max / LRA / TP dB)\n";
+            std::snprintf(line, sizeof(line), "[ PRECISION] %-22s %8s  %-36s %s\n", "signal", "rate",
+                          "FloatFilter", "Float");
+            std::cout << line;
+
+            for (const double rate : CORPUS_RATES)
+            {
+                for (const Signal& signal : makeCorpus(rate))
+                {
+                    const Measurement reference = measure<Precision::Double>(signal, rate);
+                    const Errors ff = difference(measure<Precision::FloatFilter>(signal, rate), reference);
+                    const Errors fl = difference(measure<Precision::Float>(signal, rate), reference);
+                    r.floatFilter.include(ff);
+                    r.floatThroughout.include(fl);
+
+                    std::snprintf(line, sizeof(line),
+                                  "[ PRECISION] %-22s %8.0f  %.4f %.4f %.4f %.4f %.1e   %.4f %.4f %.4f %.4f %.1e\n",
+                                  signal.name.c_str(), rate,
+                                  ff.integrated, ff.maxMomentary, ff.maxShortTerm, ff.loudnessRange, ff.truePeak,
+                                  fl.integrated, fl.maxMomentary, fl.maxShortTerm, fl.loudnessRange, fl.truePeak);
+                    std::cout << line;
+                }
+            }
+
+            std::snprintf(line, sizeof(line), "[ PRECISION] worst: FloatFilter %.4f LU, Float %.4f LU\n",
+                          r.floatFilter.worstLoudness(), r.floatThroughout.worstLoudness());
+            std::cout << line << std::flush;
+            return r;
+        }();
+        return report;
+    }
+}
+
+// ========================================================================
+// FILTER BANK
+// ========================================================================
+
+/**
+ * Every float lane matches a scalar float biquad chain exactly
+ */
+TEST(PrecisionPolicyTest, FloatFilterBankMatchesScalarFloatBiquads)
+{
+    using Bank = KWeightingBank<6, float>;
+    constexpr int numChannels = 6;
+    constexpr int stride = SIMD::roundUpToLanes(numChannels, Bank::LANES);
+    constexpr int numSamples = 1000;
+
+    double hp[5], hs[5];
+    DSPSSOT::Helpers::calculateHighPassCoeffs(DSPSSOT::KWeighting::HIGH_PASS_FC, DSPSSOT::KWeighting::HIGH_PASS_Q, 48000.0, hp);
+    DSPSSOT::Helpers::calculateHighShelfCoeffs(DSPSSOT::KWeighting::HIGH_SHELF_FC, DSPSSOT::KWeighting::HIGH_SHELF_Q,
+                                               DSPSSOT::KWeighting::HIGH_SHELF_GAIN_DB, 48000.0, hs);
+
+    auto bank = std::make_unique<Bank>();
+    bank->setCoefficients(hp, hs);
+    bank->reset();
+
+    std::vector<float> input(static_cast<size_t>(numSamples * stride), 0.0f);
+    for (int i = 0; i < numSamples; ++i)
+        for (int ch = 0; ch < numChannels; ++ch)
+            input[static_cast<size_t>(i * stride + ch)] = static_cast<float>(std::sin(0.01 * (ch + 1) * i));
+
+    alignas(SIMD::VECTOR_ALIGNMENT) static float frames[numSamples * stride];
+    std::copy(input.begin(), input.end(), frames);
+    bank->processFrames(frames, stride, numSamples);
+
+    float c[2][5];
+    for (int k = 0; k < 5; ++k)
+    {
+        c[0][k] = static_cast<float>(hp[k]);
+        c[1][k] = static_cast<float>(hs[k]);
+    }
+
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        float s[2][4]{};   // [stage][x1, x2, y1, y2]
+        for (int i = 0; i < numSamples; ++i)
+        {
+            float x = input[static_cast<size_t>(i * stride + ch)];
+            for (int stage = 0; stage < 2; ++stage)
+            {
+                const float y = c[stage][0] * x + c[stage][1] * s[stage][0] + c[stage][2] * s[stage][1]
+                              - c[stage][3] * s[stage][2] - c[stage][4] * s[stage][3];
+                s[stage][1] = s[stage][0];
+                s[stage][0] = x;
+                s[stage][3] = s[stage][2];
+                s[stage][2] = y;
+                x = y;
+            }
+            ASSERT_EQ(frames[i * stride + ch], x) << "channel " << ch << " sample " << i;
+        }
+    }
+}
+
+// ========================================================================
+// CORPUS ACCURACY
+// ========================================================================
+
+/**
+ * Float biquads with double sums: within 0.05 LU on every metric, every rate
+ */
+TEST(PrecisionPolicyTest, FloatFilterWithinTolerance)
+{
+    const Errors& errors = corpusReport().floatFilter;
+    EXPECT_LT(errors.integrated, FLOAT_FILTER_MAX_ERROR_LU);
+    EXPECT_LT(errors.maxMomentary, FLOAT_FILTER_MAX_ERROR_LU);
+    EXPECT_LT(errors.maxShortTerm, FLOAT_FILTER_MAX_ERROR_LU);
+    EXPECT_LT(errors.loudnessRange, FLOAT_FILTER_MAX_ERROR_LU);
+}
+
+/**
+ * Float throughout: within its (looser) bound
+ */
+TEST(PrecisionPolicyTest, FloatWithinTolerance)
+{
+    EXPECT_LT(corpusReport().floatThroughout.worstLoudness(), FLOAT_MAX_ERROR_LU);
+}
+
+/**
+ * True Peak runs on the original samples in double in every policy
+ */
+TEST(PrecisionPolicyTest, TruePeakIndependentOfPolicy)
+{
+    EXPECT_EQ(corpusReport().floatFilter.truePeak, 0.0);
+    EXPECT_EQ(corpusReport().floatThroughout.truePeak, 0.0);
+}
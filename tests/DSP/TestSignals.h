@@ -0,0 +1,93 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+#include "DSP/BULLsEYEProcessor.h"
+#include "SSOT/DSPSSOT.h"
+
+/**
+ * Test Signals - shared tone generators and core fixtures for the DSP tests
+ *
+ * Header-only. Tones are deterministic sines, fed to both channels of the
+ * core in host-sized blocks; makeCore() builds a reset core with the
+ * optional processing paths (block-parallel K-weighting, high-rate
+ * decimation) switched on or off.
+ */
+namespace TestSignals
+{
+    constexpr double SAMPLE_RATE = 48000.0;
+    constexpr double TONE_FREQUENCY = 1000.0;
+    constexpr int HOST_BLOCK_SIZE = 512;
+
+    /**
+     * Sine at the given amplitude (1 kHz at 48 kHz unless overridden)
+     */
+    inline std::vector<float> makeTone(double amplitude, int numSamples,
+                                       double sampleRate = SAMPLE_RATE, double frequency = TONE_FREQUENCY)
+    {
+        std::vector<float> buffer(static_cast<size_t>(numSamples));
+        for (int i = 0; i < numSamples; i++)
+            buffer[static_cast<size_t>(i)] = static_cast<float>(amplitude * std::sin(DSPSSOT::Math::TAU * frequency * i / sampleRate));
+        return buffer;
+    }
+
+    /**
+     * Feed one buffer to both channels through processBlock() in blockSize-frame host blocks
+     */
+    inline void feedBlocks(BULLsEYEProcessorCore& processor, const std::vector<float>& buffer,
+                           int blockSize = HOST_BLOCK_SIZE)
+    {
+        const int numSamples = static_cast<int>(buffer.size());
+        for (int offset = 0; offset < numSamples; offset += blockSize)
+        {
+            const int n = std::min(blockSize, numSamples - offset);
+            processor.processBlock(buffer.data() + offset, buffer.data() + offset, n);
+        }
+    }
+
+    /**
+     * Feed a 1 kHz stereo tone at the given amplitude in 512-frame host blocks
+     */
+    inline void feedTone(BULLsEYEProcessorCore& processor, double amplitude, int numSamples)
+    {
+        feedBlocks(processor, makeTone(amplitude, numSamples));
+    }
+
+    /**
+     * Optional core processing paths (both off by default, as in the plugin)
+     */
+    struct CoreOptions
+    {
+        bool blockParallelKWeighting = false;
+        bool highRateDecimation = false;
+
+        static CoreOptions withBlockParallelKWeighting(bool enabled)
+        {
+            CoreOptions options;
+            options.blockParallelKWeighting = enabled;
+            return options;
+        }
+
+        static CoreOptions withHighRateDecimation(bool enabled)
+        {
+            CoreOptions options;
+            options.highRateDecimation = enabled;
+            return options;
+        }
+    };
+
+    /**
+     * Prepared and reset core with the given paths switched on
+     */
+    inline std::unique_ptr<BULLsEYEProcessorCore> makeCore(double sampleRate, CoreOptions options = {})
+    {
+        auto core = std::make_unique<BULLsEYEProcessorCore>();
+        core->setSampleRate(sampleRate);
+        core->setBlockParallelKWeighting(options.blockParallelKWeighting);
+        core->setHighRateDecimation(options.highRateDecimation);
+        core->reset();
+        return core;
+    }
+}
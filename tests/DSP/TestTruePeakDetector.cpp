@@ -0,0 +1,299 @@
+/**
+ * @file TestTruePeakDetector.cpp
+ * @brief Unit tests for the polyphase FIR True Peak detector
+ *
+ * Tests verify:
+ * - SIMD polyphase kernel matches a scalar 48-tap reference
+ * - The early out gives bit-identical running peaks to evaluating every
+ *   output, and window peaks between the exact value and the running peak
+ * - The early out keeps skipping when the core takes a window peak every hop
+ * - Inter-sample peaks are recovered at 4x (48 kHz) and 2x (96 kHz)
+ * - 1x degenerates to sample peak
+ * - Oversampling factor follows the sample rate
+ *
+ * @note Tests are designed to run without JUCE dependencies
+ */
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+#include "DSP/BULLsEYEProcessor.h"
+#include "DSP/TruePeakDetector.h"
+#include "SSOT/DSPSSOT.h"
+
+// ========================================================================
+// HELPER FUNCTIONS
+// ========================================================================
+
+namespace
+{
+    using Detector = TruePeakDetector<2>;
+
+    /**
+     * Scalar reference: y_p[n] = sum_k h_p[k] * x[n - k] for the phases used by a factor
+     */
+    double referenceTruePeak(const std::vector<double>& x, int factor)
+    {
+        double peak = 0.0;
+        for (size_t n = 0; n < x.size(); n++)
+        {
+            peak = std::max(peak, std::abs(x[n]));
+            if (factor == 1)
+                continue;
+
+            for (int lane = 0; lane < factor; lane++)
+            {
+                const int phase = lane * (Detector::PHASES / factor);
+                double y = 0.0;
+                for (int k = Detector::TAPS - 1; k >= 0; k--)
+                {
+                    double xk = (n >= static_cast<size_t>(k)) ? x[n - k] : 0.0;
+                    y += Detector::coefficient(phase, k) * xk;
+                }
+                peak = std::max(peak, std::abs(y));
+            }
+        }
+        return peak;
+    }
+
+    /**
+     * Sine at a quarter of the sample rate, 45 degrees off the sample grid:
+     * every sample sits at +/-0.707 of the true peak
+     */
+    std::vector<float> quarterRateSine(double amplitude, int numSamples)
+    {
+        std::vector<float> x(numSamples);
+        for (int i = 0; i < numSamples; i++)
+            x[i] = static_cast<float>(amplitude * std::sin(DSPSSOT::Math::PI * 0.5 * i + DSPSSOT::Math::PI * 0.25));
+        return x;
+    }
+
+    double measureTruePeakDB(double sampleRate, const std::vector<float>& x)
+    {
+        BULLsEYEProcessorCore processor;
+        processor.setSampleRate(sampleRate);
+        processor.processBlock(x.data(), x.data(), static_cast<int>(x.size()));
+        return processor.getTruePeakDB();
+    }
+}
+
+// ========================================================================
+// DETECTOR TESTS
+// ========================================================================
+
+TEST(TruePeakDetectorTest, PhasesHaveNearUnityDCGain)
+{
+    // Annex 2 design: every phase within ~0.25 dB of unity at DC
+    for (int phase = 0; phase < Detector::PHASES; phase++)
+    {
+        double sum = 0.0;
+        for (int k = 0; k < Detector::TAPS; k++)
+            sum += Detector::coefficient(phase, k);
+        EXPECT_NEAR(sum, 1.0, 0.03) << "phase " << phase;
+    }
+}
+
+TEST(TruePeakDetectorTest, PolyphaseKernelMatchesScalarReference)
+{
+    std::vector<double> x(5000);
+    for (size_t i = 0; i < x.size(); i++)
+        x[i] = 0.6 * std::sin(0.37 * i) + 0.3 * std::sin(2.9 * i + 1.0);
+
+    for (int factor : {4, 2, 1})
+    {
+        Detector detector;
+        detector.setOversamplingFactor(factor);
+
+        // Irregular runs exercise history carry-over between calls
+        size_t offset = 0;
+        for (int run = 1; offset < x.size(); run = (run * 7) % 97 + 1)
+        {
+            int n = static_cast<int>(std::min(x.size() - offset, static_cast<size_t>(run)));
+            detector.process(0, x.data() + offset, n);
+            offset += n;
+        }
+
+        EXPECT_NEAR(detector.getPeak(), referenceTruePeak(x, factor), 1e-12) << factor << "x";
+    }
+}
+
+TEST(TruePeakDetectorTest, EarlyOutMatchesFullEvaluation)
+{
+    // Full-scale click (True Peak 1.0), then material the bound can skip,
+    // then runs built to hit each phase's worst case (input signs matching
+    // the coefficients) just below and just above the running peak
+    std::mt19937 rng(3);
+    std::normal_distribution<double> noise(0.0, 1.0);
+    std::vector<double> x(100, 0.0);
+    x.push_back(1.0);
+    for (int i = 0; i < 20000; i++)
+        x.push_back(0.03 * noise(rng) * (1.0 + (i / 3000) % 3));
+    x.insert(x.end(), 500, 0.0);
+
+    for (int phase = 0; phase < Detector::PHASES; phase++)
+    {
+        double norm = 0.0;
+        for (int k = 0; k < Detector::TAPS; k++)
+            norm += std::abs(Detector::coefficient(phase, k));
+
+        for (double level : {0.98, 1.001, 1.02})
+        {
+            TruePeakDetector<1, false> reference;
+            reference.process(0, x.data(), static_cast<int>(x.size()));
+
+            const double amplitude = level * reference.getPeak() / norm;
+            for (int k = Detector::TAPS - 1; k >= 0; k--)
+                x.push_back(Detector::coefficient(phase, k) < 0.0 ? -amplitude : amplitude);
+            for (int i = 0; i < 3000; i++)
+                x.push_back(0.01 * noise(rng));
+        }
+    }
+    x.push_back(std::nan(""));
+    x.push_back(std::numeric_limits<double>::infinity());
+
+    // Second channel: same material 3 dB down, so its own peak stays lower
+    std::vector<double> y(x.size());
+    for (size_t i = 0; i < x.size(); i++)
+        y[i] = 0.7 * x[i];
+
+    // Without window restarts (analyzer) and with frequent ones (history stream)
+    for (int windowRuns : {0, 40})
+    {
+        for (int factor : {4, 2})
+        {
+            Detector fast;
+            TruePeakDetector<2, false> full;
+            fast.setOversamplingFactor(factor);
+            full.setOversamplingFactor(factor);
+
+            size_t offset = 0;
+            int runs = 0;
+            for (int run = 1; offset < x.size(); run = (run * 7) % 97 + 1, runs++)
+            {
+                const int n = static_cast<int>(std::min(x.size() - offset, static_cast<size_t>(run)));
+                fast.process(0, x.data() + offset, n);
+                full.process(0, x.data() + offset, n);
+                fast.process(1, y.data() + offset, n);
+                full.process(1, y.data() + offset, n);
+                offset += n;
+
+                ASSERT_EQ(fast.getChannelPeak(0), full.getChannelPeak(0)) << factor << "x at " << offset;
+                ASSERT_EQ(fast.getChannelPeak(1), full.getChannelPeak(1)) << factor << "x at " << offset;
+                if (windowRuns > 0 && runs % windowRuns == windowRuns - 1)
+                {
+                    // Window peaks: upper estimate, capped by the running peak
+                    const double window = fast.takeWindowPeak();
+                    ASSERT_GE(window, full.takeWindowPeak()) << factor << "x at " << offset;
+                    ASSERT_LE(window, fast.getPeak()) << factor << "x at " << offset;
+                }
+            }
+
+            EXPECT_EQ(fast.getPeak(), full.getPeak()) << factor << "x";
+            const double window = fast.takeWindowPeak();
+            EXPECT_GE(window, full.takeWindowPeak()) << factor << "x";
+            EXPECT_LE(window, fast.getPeak()) << factor << "x";
+        }
+    }
+}
+
+TEST(TruePeakDetectorTest, OneTimesIsSamplePeak)
+{
+    Detector detector;
+    detector.setOversamplingFactor(1);
+
+    const double x[4] = {0.1, -0.8, 0.3, 0.0};
+    detector.process(1, x, 4);
+
+    EXPECT_DOUBLE_EQ(detector.getPeak(), 0.8);
+    EXPECT_DOUBLE_EQ(detector.getChannelPeak(0), 0.0);
+}
+
+TEST(TruePeakDetectorTest, InvalidSamplesAreIgnored)
+{
+    Detector detector;
+    const double x[3] = {std::nan(""), std::numeric_limits<double>::infinity(), 0.25};
+    detector.process(0, x, 3);
+
+    EXPECT_FALSE(std::isnan(detector.getPeak()));
+    EXPECT_LT(detector.getPeak(), 1.0);
+}
+
+// ========================================================================
+// CORE INTEGRATION TESTS
+// ========================================================================
+
+TEST(TruePeakDetectorTest, OversamplingFollowsSampleRate)
+{
+    const struct { double rate; int factor; } cases[] = {
+        {44100.0, 4}, {48000.0, 4}, {88200.0, 2}, {96000.0, 2}, {176400.0, 1}, {192000.0, 1}
+    };
+
+    for (const auto& c : cases)
+    {
+        BULLsEYEProcessorCore processor;
+        processor.setSampleRate(c.rate);
+        EXPECT_EQ(processor.getTruePeakOversamplingFactor(), c.factor) << c.rate;
+    }
+}
+
+/**
+ * The core takes a window peak every 100 ms hop (history stream); the early
+ * out still skips material below the running peak, and every hop's True
+ * Peak stays between its sample peak and the running peak
+ */
+TEST(TruePeakDetectorTest, CoreEarlyOutSkipsWithHistoryEnabled)
+{
+    constexpr double rate = 48000.0;
+    constexpr int blockSize = 512;
+    BULLsEYEProcessorCore processor;
+    processor.setSampleRate(rate);
+    processor.setHistoryCapacity(200);
+
+    std::vector<float> click(blockSize, 0.0f);
+    click[blockSize / 2] = 1.0f;
+    processor.processBlock(click.data(), click.data(), blockSize);
+    const long long before = processor.getTruePeakInterpolatedSamples();
+
+    // 10 s of a -12 dBFS tone: its bound (L1 norm x 0.25) stays below the click
+    std::vector<float> tone(static_cast<size_t>(rate) * 10);
+    for (size_t i = 0; i < tone.size(); ++i)
+        tone[i] = static_cast<float>(0.25 * std::sin(DSPSSOT::Math::TAU * 997.0 * static_cast<double>(i) / rate));
+    for (size_t offset = 0; offset + blockSize <= tone.size(); offset += blockSize)
+        processor.processBlock(tone.data() + offset, tone.data() + offset, blockSize);
+
+    const double interpolated = static_cast<double>(processor.getTruePeakInterpolatedSamples() - before);
+    EXPECT_LT(interpolated / (2.0 * static_cast<double>(tone.size())), 0.05);
+
+    int records = 0;
+    processor.drainHistory([&](const LoudnessHopRecord& record)
+    {
+        ++records;
+        EXPECT_GE(record.truePeak, record.samplePeak);
+        EXPECT_LE(record.truePeak, 1.0f);
+    });
+    EXPECT_GT(records, 90);
+}
+
+TEST(TruePeakDetectorTest, RecoversInterSamplePeakAt48k)
+{
+    // Sample peak is -3 dB below the true peak
+    std::vector<float> x = quarterRateSine(0.5, 4800);
+
+    EXPECT_NEAR(measureTruePeakDB(48000.0, x), 20.0 * std::log10(0.5), 0.3);
+}
+
+TEST(TruePeakDetectorTest, RecoversInterSamplePeakAt96k)
+{
+    std::vector<float> x = quarterRateSine(0.5, 9600);
+
+    EXPECT_NEAR(measureTruePeakDB(96000.0, x), 20.0 * std::log10(0.5), 0.3);
+}
+
+TEST(TruePeakDetectorTest, HighRatesReadSamplePeak)
+{
+    std::vector<float> x = quarterRateSine(0.5, 19200);
+
+    EXPECT_NEAR(measureTruePeakDB(192000.0, x), 20.0 * std::log10(0.5 * std::sqrt(0.5)), 1e-3);
+}
@@ -0,0 +1,377 @@
+#include "RealtimeSafetyGuard.h"
+
+#include <atomic>
+
+// Sanitizers interpose the allocator and pthread themselves
+#if defined(__SANITIZE_ADDRESS__) || defined(__SANITIZE_THREAD__)
+    #define BULLSEYE_RT_GUARD_SANITIZED 1
+#elif defined(__has_feature)
+    #if __has_feature(address_sanitizer) || __has_feature(thread_sanitizer) || __has_feature(memory_sanitizer)
+        #define BULLSEYE_RT_GUARD_SANITIZED 1
+    #endif
+#endif
+
+#if defined(__linux__) && defined(__GLIBC__) && !defined(BULLSEYE_RT_GUARD_SANITIZED)
+    #define BULLSEYE_RT_GUARD 1
+#else
+    #define BULLSEYE_RT_GUARD 0
+#endif
+
+#if BULLSEYE_RT_GUARD
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <new>
+#include <pthread.h>
+
+// glibc's allocator entry points (what malloc & co. resolve to without us)
+extern "C"
+{
+    void* __libc_malloc(std::size_t size);
+    void* __libc_calloc(std::size_t count, std::size_t size);
+    void* __libc_realloc(void* ptr, std::size_t size);
+    void* __libc_memalign(std::size_t alignment, std::size_t size);
+    void __libc_free(void* ptr);
+}
+
+// ========================================================================
+// VIOLATION LOG (fixed storage: recording must not allocate)
+// ========================================================================
+
+namespace
+{
+    using RealtimeSafety::Kind;
+
+    constexpr int MAX_VIOLATIONS = 16;
+    constexpr int MAX_FRAMES = 32;
+    constexpr int SKIPPED_FRAMES = 2;   // record() and the interposed function
+    constexpr int NUM_KINDS = static_cast<int>(Kind::MutexLock) + 1;
+
+    struct Violation
+    {
+        Kind kind{Kind::Malloc};
+        std::size_t size{0};
+        int numFrames{0};
+        void* frames[MAX_FRAMES]{};
+    };
+
+    Violation violations[MAX_VIOLATIONS];
+    std::atomic<int> violationCount{0};
+    std::atomic<int> kindCounts[NUM_KINDS]{};
+
+    thread_local int scopeDepth = 0;
+    thread_local bool recording = false;   // backtrace() itself may allocate
+
+    // Called directly by every interposed function (never in tail position),
+    // so the caller is always SKIPPED_FRAMES up the stack
+    __attribute__((noinline)) void record(Kind kind, std::size_t size) noexcept
+    {
+        if (scopeDepth == 0 || recording)
+            return;
+
+        recording = true;
+        kindCounts[static_cast<int>(kind)].fetch_add(1, std::memory_order_relaxed);
+
+        const int index = violationCount.fetch_add(1, std::memory_order_relaxed);
+        if (index < MAX_VIOLATIONS)
+        {
+            Violation& violation = violations[index];
+            violation.kind = kind;
+            violation.size = size;
+            violation.numFrames = backtrace(violation.frames, MAX_FRAMES);
+        }
+        recording = false;
+    }
+
+    const char* kindName(Kind kind) noexcept
+    {
+        switch (kind)
+        {
+            case Kind::OperatorNew: return "operator new";
+            case Kind::OperatorDelete: return "operator delete";
+            case Kind::Malloc: return "malloc";
+            case Kind::Free: return "free";
+            case Kind::MutexLock: return "pthread_mutex_lock";
+        }
+        return "?";
+    }
+
+    // "binary(_ZN3foo3barEv+0x12) [0x...]" -> "binary(foo::bar()+0x12) [0x...]"
+    std::string demangleFrame(const char* frame)
+    {
+        std::string line(frame);
+        const size_t open = line.find('(');
+        const size_t plus = line.find('+', open);
+        if (open == std::string::npos || plus == std::string::npos || plus == open + 1)
+            return line;
+
+        int status = 0;
+        char* demangled = abi::__cxa_demangle(line.substr(open + 1, plus - open - 1).c_str(), nullptr, nullptr, &status);
+        if (status == 0 && demangled != nullptr)
+            line.replace(open + 1, plus - open - 1, demangled);
+        std::free(demangled);
+        return line;
+    }
+
+    // ========================================================================
+    // ALLOCATION / LOCK PASS-THROUGH
+    // ========================================================================
+
+    void* allocate(std::size_t size, std::size_t alignment) noexcept
+    {
+        if (size == 0)
+            size = 1;
+        return alignment > alignof(std::max_align_t) ? __libc_memalign(alignment, size) : __libc_malloc(size);
+    }
+
+    void* allocateOrThrow(std::size_t size, std::size_t alignment)
+    {
+        void* ptr = allocate(size, alignment);
+        if (ptr == nullptr)
+            throw std::bad_alloc();
+        return ptr;
+    }
+
+    // Inlined so record() stays SKIPPED_FRAMES below the caller
+    __attribute__((always_inline)) inline void deallocate(void* ptr) noexcept
+    {
+        if (ptr != nullptr)
+        {
+            record(Kind::OperatorDelete, 0);
+            __libc_free(ptr);
+        }
+    }
+
+    using MutexFunction = int (*)(pthread_mutex_t*);
+    std::atomic<MutexFunction> realMutexLock{nullptr};
+    std::atomic<MutexFunction> realMutexTryLock{nullptr};
+
+    MutexFunction resolve(std::atomic<MutexFunction>& slot, const char* name) noexcept
+    {
+        MutexFunction function = slot.load(std::memory_order_acquire);
+        if (function == nullptr)
+        {
+            function = reinterpret_cast<MutexFunction>(dlsym(RTLD_NEXT, name));
+            slot.store(function, std::memory_order_release);
+        }
+        return function;
+    }
+
+    // Resolve the real pthread functions and load backtrace()'s unwinder
+    // before any test enters a Scope
+    __attribute__((constructor)) void initialiseGuard()
+    {
+        resolve(realMutexLock, "pthread_mutex_lock");
+        resolve(realMutexTryLock, "pthread_mutex_trylock");
+
+        void* frames[4];
+        backtrace(frames, 4);
+    }
+}
+
+// ========================================================================
+// INTERPOSED C FUNCTIONS
+// ========================================================================
+
+extern "C"
+{
+    void* malloc(std::size_t size) noexcept
+    {
+        record(Kind::Malloc, size);
+        return __libc_malloc(size);
+    }
+
+    void* calloc(std::size_t count, std::size_t size) noexcept
+    {
+        record(Kind::Malloc, count * size);
+        return __libc_calloc(count, size);
+    }
+
+    void* realloc(void* ptr, std::size_t size) noexcept
+    {
+        record(Kind::Malloc, size);
+        return __libc_realloc(ptr, size);
+    }
+
+    void* memalign(std::size_t alignment, std::size_t size) noexcept
+    {
+        record(Kind::Malloc, size);
+        return __libc_memalign(alignment, size);
+    }
+
+    void* aligned_alloc(std::size_t alignment, std::size_t size) noexcept
+    {
+        record(Kind::Malloc, size);
+        return __libc_memalign(alignment, size);
+    }
+
+    int posix_memalign(void** out, std::size_t alignment, std::size_t size) noexcept
+    {
+        record(Kind::Malloc, size);
+        void* ptr = __libc_memalign(alignment, size);
+        if (ptr == nullptr)
+            return ENOMEM;
+        *out = ptr;
+        return 0;
+    }
+
+    void free(void* ptr) noexcept
+    {
+        if (ptr != nullptr)
+            record(Kind::Free, 0);
+        __libc_free(ptr);
+    }
+
+    int pthread_mutex_lock(pthread_mutex_t* mutex) noexcept
+    {
+        record(Kind::MutexLock, 0);
+        return resolve(realMutexLock, "pthread_mutex_lock")(mutex);
+    }
+
+    int pthread_mutex_trylock(pthread_mutex_t* mutex) noexcept
+    {
+        record(Kind::MutexLock, 0);
+        return resolve(realMutexTryLock, "pthread_mutex_trylock")(mutex);
+    }
+}
+
+// ========================================================================
+// INTERPOSED OPERATOR NEW / DELETE
+// ========================================================================
+
+void* operator new(std::size_t size)
+{
+    record(Kind::OperatorNew, size);
+    return allocateOrThrow(size, 0);
+}
+
+void* operator new[](std::size_t size)
+{
+    record(Kind::OperatorNew, size);
+    return allocateOrThrow(size, 0);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    record(Kind::OperatorNew, size);
+    return allocate(size, 0);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    record(Kind::OperatorNew, size);
+    return allocate(size, 0);
+}
+
+void* operator new(std::size_t size, std::align_val_t align)
+{
+    record(Kind::OperatorNew, size);
+    return allocateOrThrow(size, static_cast<std::size_t>(align));
+}
+
+void* operator new[](std::size_t size, std::align_val_t align)
+{
+    record(Kind::OperatorNew, size);
+    return allocateOrThrow(size, static_cast<std::size_t>(align));
+}
+
+void* operator new(std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept
+{
+    record(Kind::OperatorNew, size);
+    return allocate(size, static_cast<std::size_t>(align));
+}
+
+void* operator new[](std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept
+{
+    record(Kind::OperatorNew, size);
+    return allocate(size, static_cast<std::size_t>(align));
+}
+
+// Deleting nullptr is allowed on the audio path (no call into the allocator)
+void operator delete(void* ptr) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr) noexcept { deallocate(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { deallocate(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { deallocate(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { deallocate(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { deallocate(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { deallocate(ptr); }
+
+// ========================================================================
+// PUBLIC API
+// ========================================================================
+
+namespace RealtimeSafety
+{
+    Scope::Scope() noexcept { ++scopeDepth; }
+    Scope::~Scope() { --scopeDepth; }
+
+    bool isAvailable() noexcept { return true; }
+
+    int getViolationCount() noexcept { return violationCount.load(std::memory_order_relaxed); }
+
+    int getViolationCount(Kind kind) noexcept
+    {
+        return kindCounts[static_cast<int>(kind)].load(std::memory_order_relaxed);
+    }
+
+    void clearViolations() noexcept
+    {
+        for (auto& count : kindCounts)
+            count.store(0, std::memory_order_relaxed);
+        violationCount.store(0, std::memory_order_relaxed);
+    }
+
+    std::string describeViolations()
+    {
+        const int total = getViolationCount();
+        const int stored = total < MAX_VIOLATIONS ? total : MAX_VIOLATIONS;
+
+        std::string out;
+        for (int i = 0; i < stored; ++i)
+        {
+            const Violation& violation = violations[i];
+            out += "#" + std::to_string(i + 1) + " " + kindName(violation.kind);
+            if (violation.size > 0)
+                out += " (" + std::to_string(violation.size) + " bytes)";
+            out += "\n";
+
+            char** symbols = backtrace_symbols(violation.frames, violation.numFrames);
+            for (int f = SKIPPED_FRAMES; symbols != nullptr && f < violation.numFrames; ++f)
+                out += "    " + demangleFrame(symbols[f]) + "\n";
+            std::free(symbols);
+        }
+
+        if (total > stored)
+            out += "... " + std::to_string(total - stored) + " more\n";
+        return out;
+    }
+}
+
+#else
+
+// ========================================================================
+// UNSUPPORTED PLATFORM: no interposition, tests skip
+// ========================================================================
+
+namespace RealtimeSafety
+{
+    Scope::Scope() noexcept {}
+    Scope::~Scope() {}
+
+    bool isAvailable() noexcept { return false; }
+    int getViolationCount() noexcept { return 0; }
+    int getViolationCount(Kind) noexcept { return 0; }
+    void clearViolations() noexcept {}
+    std::string describeViolations() { return {}; }
+}
+
+#endif
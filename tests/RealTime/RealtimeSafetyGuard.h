@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+/**
+ * Real-Time Safety Guard - test-only audio-path checker
+ *
+ * RealtimeSafetyGuard.cpp interposes global operator new / delete, the
+ * malloc family and pthread_mutex_lock / trylock in the test executable.
+ * Outside a Scope every call passes straight through to glibc. Inside a
+ * Scope (on that thread only) each call is recorded as a violation with
+ * its backtrace before being passed on, so the test keeps running and
+ * can report every offender at once.
+ *
+ * Enforces ProcessorSSOT::ThreadSafety (no allocations, no locks in the
+ * audio path). Available on Linux / glibc builds without AddressSanitizer
+ * (which interposes the allocator itself); elsewhere isAvailable() is
+ * false and the tests skip.
+ */
+namespace RealtimeSafety
+{
+    enum class Kind
+    {
+        OperatorNew,
+        OperatorDelete,
+        Malloc,
+        Free,
+        MutexLock
+    };
+
+    /**
+     * Marks the enclosing scope as audio-thread code (nests; this thread only)
+     */
+    class Scope
+    {
+    public:
+        Scope() noexcept;
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+
+    bool isAvailable() noexcept;
+
+    /**
+     * Violations recorded since the last clearViolations() (all threads)
+     */
+    int getViolationCount() noexcept;
+    int getViolationCount(Kind kind) noexcept;
+    void clearViolations() noexcept;
+
+    /**
+     * Each stored violation with a demangled backtrace (allocates: call outside a Scope)
+     */
+    std::string describeViolations();
+}
+
+/**
+ * Run statement as audio-thread code; fail the test with the offending
+ * backtraces if it allocated, freed or locked a mutex
+ */
+#define EXPECT_REALTIME_SAFE(...)                                                    \
+    do                                                                               \
+    {                                                                                \
+        RealtimeSafety::clearViolations();                                           \
+        {                                                                            \
+            const RealtimeSafety::Scope realtimeScope;                               \
+            __VA_ARGS__;                                                             \
+        }                                                                            \
+        EXPECT_EQ(RealtimeSafety::getViolationCount(), 0)                            \
+            << "audio path is not real-time safe:\n" << RealtimeSafety::describeViolations(); \
+    } while (false)
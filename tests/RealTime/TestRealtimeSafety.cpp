@@ -0,0 +1,308 @@
+/**
+ * @file TestRealtimeSafety.cpp
+ * @brief Real-time safety of the audio path (no allocations, no locks)
+ *
+ * Tests verify:
+ * - The guard catches operator new, malloc / free and mutex locks
+ * - BULLsEYEProcessorCore processing, reset and content type changes at
+ *   every supported rate, layout and host buffer size
+ * - CallbackTimer recording (BULLSEYE_ENABLE_TIMING builds)
+ * - The license engine's audio-thread API (atomic reads only)
+ *
+ * Enforces ProcessorSSOT::ThreadSafety; see RealtimeSafetyGuard.h.
+ *
+ * @note Tests are designed to run without JUCE dependencies
+ */
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "RealtimeSafetyGuard.h"
+#include "DSP/BULLsEYEProcessor.h"
+#include "DSP/CallbackTiming.h"
+#include "SSOT/DSPSSOT.h"
+#include "SSOT/ProcessorSSOT.h"
+#include "LICENSE_ENGINE.hpp"
+
+// ========================================================================
+// HELPER FUNCTIONS
+// ========================================================================
+
+namespace
+{
+    constexpr int NUM_CHANNELS = ProcessorSSOT::Channels::MAX_INPUT_CHANNELS;
+
+    /**
+     * Host-style input: one buffer per channel, filled before the audio scope
+     */
+    struct HostBuffers
+    {
+        std::vector<std::vector<float>> data;
+        std::vector<const float*> pointers;
+
+        HostBuffers(double sampleRate, int numSamples)
+            : data(NUM_CHANNELS, std::vector<float>(static_cast<size_t>(numSamples)))
+        {
+            for (int ch = 0; ch < NUM_CHANNELS; ++ch)
+            {
+                for (int i = 0; i < numSamples; ++i)
+                {
+                    data[static_cast<size_t>(ch)][static_cast<size_t>(i)] = static_cast<float>(
+                        0.3 * std::sin(DSPSSOT::Math::TAU * (200.0 + 50.0 * ch) * i / sampleRate));
+                }
+                pointers.push_back(data[static_cast<size_t>(ch)].data());
+            }
+        }
+    };
+
+    /**
+     * A core prepared the way prepareToPlay does it (allocations happen here)
+     */
+    std::unique_ptr<BULLsEYEProcessorCore> makePreparedCore(double sampleRate, int historySeconds)
+    {
+        auto core = std::make_unique<BULLsEYEProcessorCore>();
+        core->setSampleRate(sampleRate);
+        core->reset();
+        core->setHistoryCapacity(ProcessorSSOT::History::capacityForSeconds(historySeconds));
+        return core;
+    }
+}
+
+#define SKIP_IF_GUARD_UNAVAILABLE()                                                       \
+    if (!RealtimeSafety::isAvailable())                                                   \
+        GTEST_SKIP() << "allocation / lock interposition needs Linux glibc without sanitizers"
+
+// ========================================================================
+// GUARD SELF-CHECK
+// ========================================================================
+
+/**
+ * Allocations, frees and locks inside a scope are recorded; outside are not
+ */
+TEST(RealtimeSafetyGuardTest, DetectsAllocationsAndLocks)
+{
+    SKIP_IF_GUARD_UNAVAILABLE();
+
+    std::mutex mutex;
+    int* outside = new int(1);
+
+    RealtimeSafety::clearViolations();
+    {
+        const RealtimeSafety::Scope scope;
+
+        // volatile: the optimizer may otherwise elide new/delete and malloc/free pairs
+        int* volatile inside = new int(2);
+        delete inside;
+
+        void* volatile block = std::malloc(64);
+        std::free(block);
+
+        mutex.lock();
+        mutex.unlock();
+    }
+    delete outside;
+
+    EXPECT_EQ(RealtimeSafety::getViolationCount(RealtimeSafety::Kind::OperatorNew), 1);
+    EXPECT_EQ(RealtimeSafety::getViolationCount(RealtimeSafety::Kind::OperatorDelete), 1);
+    EXPECT_EQ(RealtimeSafety::getViolationCount(RealtimeSafety::Kind::Malloc), 1);
+    EXPECT_EQ(RealtimeSafety::getViolationCount(RealtimeSafety::Kind::Free), 1);
+    EXPECT_EQ(RealtimeSafety::getViolationCount(RealtimeSafety::Kind::MutexLock), 1);
+
+    // Backtrace names the offending function
+    const std::string report = RealtimeSafety::describeViolations();
+    EXPECT_NE(report.find("RealtimeSafetyGuardTest_DetectsAllocationsAndLocks"), std::string::npos) << report;
+
+    RealtimeSafety::clearViolations();
+    EXPECT_EQ(RealtimeSafety::getViolationCount(), 0);
+}
+
+/**
+ * Nothing is recorded once the scope has closed
+ */
+TEST(RealtimeSafetyGuardTest, AllocationsOutsideScopeAreNotChecked)
+{
+    SKIP_IF_GUARD_UNAVAILABLE();
+
+    RealtimeSafety::clearViolations();
+    {
+        const RealtimeSafety::Scope scope;
+    }
+    auto unguarded = std::make_unique<std::vector<int>>(100);
+    unguarded.reset();
+
+    EXPECT_EQ(RealtimeSafety::getViolationCount(), 0);
+}
+
+// ========================================================================
+// DSP CORE
+// ========================================================================
+
+/**
+ * processBlock at every supported rate, all layouts, host buffers 1 - 8192
+ * (odd sizes split sub-blocks and the True Peak batch at every offset)
+ */
+TEST(RealtimeSafetyTest, CoreProcessBlockIsRealtimeSafe)
+{
+    SKIP_IF_GUARD_UNAVAILABLE();
+
+    for (const double rate : ProcessorSSOT::SampleRate::SUPPORTED_RATES)
+    {
+        SCOPED_TRACE(rate);
+        auto core = makePreparedCore(rate, 600);
+        const HostBuffers input(rate, ProcessorSSOT::Buffer::MAX_BUFFER_SIZE);
+
+        for (const int numChannels : {1, 2, 6, 8, NUM_CHANNELS})
+        {
+            EXPECT_REALTIME_SAFE(
+                for (const int bufferSize : {1, 17, 64, 480, 512, 1000, 4096, ProcessorSSOT::Buffer::MAX_BUFFER_SIZE})
+                    core->processBlock(input.pointers.data(), numChannels, bufferSize));
+        }
+    }
+}
+
+/**
+ * Per-sample process() and the stereo pointer overload
+ */
+TEST(RealtimeSafetyTest, CoreStereoPathsAreRealtimeSafe)
+{
+    SKIP_IF_GUARD_UNAVAILABLE();
+
+    constexpr double rate = 48000.0;
+    auto core = makePreparedCore(rate, 600);
+    const HostBuffers input(rate, 4800);
+
+    EXPECT_REALTIME_SAFE(
+        for (int i = 0; i < 4800; ++i)
+        {
+            float left = input.data[0][static_cast<size_t>(i)];
+            float right = input.data[1][static_cast<size_t>(i)];
+            core->process(left, right);
+        }
+        core->processBlock(input.pointers[0], input.pointers[1], 4800));
+}
+
+/**
+ * Long run: ring resyncs, thousands of hops and a full history stream
+ * (records dropped, not reallocated, while nobody drains)
+ */
+TEST(RealtimeSafetyTest, CoreLongRunWithFullHistoryIsRealtimeSafe)
+{
+    SKIP_IF_GUARD_UNAVAILABLE();
+
+    constexpr double rate = 48000.0;
+    constexpr int bufferSize = 512;
+    auto core = makePreparedCore(rate, 10);   // 100 records, overflows after 10 s
+    const HostBuffers input(rate, bufferSize);
+
+    EXPECT_REALTIME_SAFE(
+        for (int i = 0; i < 60 * 48000 / bufferSize; ++i)
+            core->processBlock(input.pointers.data(), 2, bufferSize));
+
+    EXPECT_GT(core->getHistoryDroppedCount(), 0u);
+}
+
+/**
+ * What the processor does on the audio thread besides processing:
+ * transport-start reset and per-block content type polling
+ */
+TEST(RealtimeSafetyTest, CoreResetAndContentTypeAreRealtimeSafe)
+{
+    SKIP_IF_GUARD_UNAVAILABLE();
+
+    constexpr double rate = 96000.0;
+    auto core = makePreparedCore(rate, 600);
+    const HostBuffers input(rate, 1024);
+
+    EXPECT_REALTIME_SAFE(
+        for (int i = 0; i < 200; ++i)
+        {
+            core->setContentType(static_cast<ModelSSOT::ContentType>(i % 3));
+            core->processBlock(input.pointers.data(), 2, 1024);
+            if (i % 50 == 49)
+                core->reset();
+        });
+}
+
+// ========================================================================
+// CALLBACK TIMING
+// ========================================================================
+
+/**
+ * CallbackTimer::Scope is what processBlock runs in timing builds
+ */
+TEST(RealtimeSafetyTest, CallbackTimerIsRealtimeSafe)
+{
+    SKIP_IF_GUARD_UNAVAILABLE();
+
+    auto timer = std::make_unique<CallbackTimer>();
+    timer->prepare(48000.0);
+
+    EXPECT_REALTIME_SAFE(
+        for (int i = 0; i < 1000; ++i)
+        {
+            const CallbackTimer::Scope scope(*timer, 256);
+        });
+    EXPECT_EQ(timer->getStats().callbacks, 1000u);
+}
+
+// ========================================================================
+// LICENSE ENGINE (portable-license-drop-in)
+// ========================================================================
+
+/**
+ * The atomic API is the only part the audio thread may call
+ */
+TEST(RealtimeSafetyTest, LicenseAtomicApiIsRealtimeSafe)
+{
+    SKIP_IF_GUARD_UNAVAILABLE();
+
+    auto engine = std::make_unique<LicenseEngine::LicenseEngine>();
+    LicenseEngine::LicenseConfig config;
+    config.productName = "BULLsEYE-RealtimeSafetyTest";
+    ASSERT_TRUE(engine->initialize(config));
+
+    bool licensed = false;
+    std::int64_t days = 0;
+    bool grace = true;
+    bool feature = true;
+
+    EXPECT_REALTIME_SAFE(
+        for (int i = 0; i < 1000; ++i)
+        {
+            licensed = engine->isLicensedAtomically();
+            days = engine->getDaysRemainingAtomically();
+            grace = engine->isInGracePeriodAtomically();
+            feature = engine->isFeatureEnabledAtomically(static_cast<std::uint32_t>(i % LicenseEngine::MAX_FEATURES));
+        });
+
+    EXPECT_TRUE(licensed);   // trial
+    EXPECT_GT(days, 0);
+    EXPECT_FALSE(grace);
+    EXPECT_FALSE(feature);
+}
+
+/**
+ * The UI-thread API locks, and the guard reports it (never call it from processBlock)
+ */
+TEST(RealtimeSafetyTest, LicenseUiApiIsCaught)
+{
+    SKIP_IF_GUARD_UNAVAILABLE();
+
+    auto engine = std::make_unique<LicenseEngine::LicenseEngine>();
+    LicenseEngine::LicenseConfig config;
+    config.productName = "BULLsEYE-RealtimeSafetyTest";
+    ASSERT_TRUE(engine->initialize(config));
+
+    bool licensed = false;
+    RealtimeSafety::clearViolations();
+    {
+        const RealtimeSafety::Scope scope;
+        licensed = engine->isLicensed();
+    }
+    EXPECT_TRUE(licensed);
+    EXPECT_GE(RealtimeSafety::getViolationCount(RealtimeSafety::Kind::MutexLock), 1);
+    RealtimeSafety::clearViolations();
+}
@@ -0,0 +1,482 @@
+/**
+ * @file TestAnalyzer.cpp
+ * @brief Unit tests for the offline file analyzer
+ *
+ * Tests verify:
+ * - WAV (16/24-bit PCM, 32-bit float extensible) and AIFF decode correctly
+ * - Chunked reads and seeks return the same samples as a single read
+ * - analyzeFile() matches feeding the core directly
+ * - Mono files (block-parallel K-weighting) match the bank within 1e-9 LU
+ * - Segmented (parallel) analysis matches one sequential pass
+ * - LUFS-only and True-Peak-only analysis match the full analysis
+ * - Unreadable files are reported as errors, not crashes
+ *
+ * @note Tests are designed to run without JUCE dependencies
+ */
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include "AudioFileReader.h"
+#include "LoudnessAnalyzer.h"
+#include "DSP/BULLsEYEProcessor.h"
+#include "SSOT/DSPSSOT.h"
+
+// ========================================================================
+// HELPER FUNCTIONS
+// ========================================================================
+
+namespace
+{
+    constexpr int TEST_SAMPLE_RATE = 48000;
+    constexpr int TEST_CHANNELS = 2;
+
+    std::vector<std::vector<float>> makeSignal(int numFrames)
+    {
+        std::vector<std::vector<float>> signal(TEST_CHANNELS, std::vector<float>(static_cast<size_t>(numFrames)));
+        for (int i = 0; i < numFrames; i++)
+        {
+            const double t = static_cast<double>(i) / TEST_SAMPLE_RATE;
+            // Loudness steps up every second so LRA and max M differ from integrated
+            const double amplitude = 0.05 * (1 + (i / TEST_SAMPLE_RATE) % 4);
+            signal[0][i] = static_cast<float>(amplitude * std::sin(DSPSSOT::Math::TAU * 1000.0 * t));
+            signal[1][i] = static_cast<float>(amplitude * std::sin(DSPSSOT::Math::TAU * 440.0 * t));
+        }
+        return signal;
+    }
+
+    void putLE(std::vector<unsigned char>& out, std::uint64_t value, int bytes)
+    {
+        for (int b = 0; b < bytes; b++)
+            out.push_back(static_cast<unsigned char>(value >> (8 * b)));
+    }
+
+    void putBE(std::vector<unsigned char>& out, std::uint64_t value, int bytes)
+    {
+        for (int b = bytes - 1; b >= 0; b--)
+            out.push_back(static_cast<unsigned char>(value >> (8 * b)));
+    }
+
+    void putTag(std::vector<unsigned char>& out, const char* tag)
+    {
+        out.insert(out.end(), tag, tag + 4);
+    }
+
+    std::int32_t quantize(float sample, int bits)
+    {
+        const double scale = std::ldexp(1.0, bits - 1);
+        return static_cast<std::int32_t>(std::lround(std::fmax(-1.0, std::fmin(sample, 0.999999)) * scale));
+    }
+
+    // WAV: bits 16/24 = PCM, 32 = IEEE float via WAVE_FORMAT_EXTENSIBLE
+    std::vector<unsigned char> makeWav(const std::vector<std::vector<float>>& signal, int bits,
+                                       int sampleRate = TEST_SAMPLE_RATE)
+    {
+        const int numFrames = static_cast<int>(signal[0].size());
+        const int numChannels = static_cast<int>(signal.size());
+        const int bytesPerSample = bits / 8;
+        const bool isFloat = bits == 32;
+        const std::uint32_t dataBytes = static_cast<std::uint32_t>(numFrames * numChannels * bytesPerSample);
+        const std::uint32_t fmtBytes = isFloat ? 40 : 16;
+
+        std::vector<unsigned char> out;
+        putTag(out, "RIFF");
+        putLE(out, 4 + 8 + fmtBytes + 8 + dataBytes, 4);
+        putTag(out, "WAVE");
+
+        putTag(out, "fmt ");
+        putLE(out, fmtBytes, 4);
+        putLE(out, isFloat ? 0xFFFE : 1, 2);
+        putLE(out, numChannels, 2);
+        putLE(out, sampleRate, 4);
+        putLE(out, static_cast<std::uint64_t>(sampleRate) * numChannels * bytesPerSample, 4);
+        putLE(out, static_cast<std::uint64_t>(numChannels * bytesPerSample), 2);
+        putLE(out, static_cast<std::uint64_t>(bits), 2);
+        if (isFloat)
+        {
+            putLE(out, 22, 2);                 // cbSize
+            putLE(out, static_cast<std::uint64_t>(bits), 2);   // valid bits
+            putLE(out, 3, 4);                  // channel mask (FL | FR)
+            putLE(out, 3, 2);                  // sub-format GUID: IEEE float
+            const unsigned char guidTail[14] = {0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80,
+                                                0x00, 0x00, 0xAA, 0x00, 0x38, 0x9B, 0x71};
+            out.insert(out.end(), guidTail, guidTail + 14);
+        }
+
+        putTag(out, "data");
+        putLE(out, dataBytes, 4);
+        for (int i = 0; i < numFrames; i++)
+        {
+            for (int ch = 0; ch < numChannels; ch++)
+            {
+                if (isFloat)
+                {
+                    std::uint32_t raw;
+                    std::memcpy(&raw, &signal[ch][i], 4);
+                    putLE(out, raw, 4);
+                }
+                else
+                {
+                    putLE(out, static_cast<std::uint32_t>(quantize(signal[ch][i], bits)), bytesPerSample);
+                }
+            }
+        }
+        return out;
+    }
+
+    // AIFF: 16-bit big-endian PCM with an 80-bit extended sample rate
+    std::vector<unsigned char> makeAiff(const std::vector<std::vector<float>>& signal)
+    {
+        const int numFrames = static_cast<int>(signal[0].size());
+        const std::uint32_t ssndBytes = 8 + static_cast<std::uint32_t>(numFrames * TEST_CHANNELS * 2);
+
+        std::vector<unsigned char> out;
+        putTag(out, "FORM");
+        putBE(out, 4 + 8 + 18 + 8 + ssndBytes, 4);
+        putTag(out, "AIFF");
+
+        putTag(out, "COMM");
+        putBE(out, 18, 4);
+        putBE(out, TEST_CHANNELS, 2);
+        putBE(out, static_cast<std::uint64_t>(numFrames), 4);
+        putBE(out, 16, 2);
+        // 48000 = 1.465 * 2^15: exponent 16383 + 15, mantissa 48000 << 48
+        putBE(out, 16383 + 15, 2);
+        putBE(out, static_cast<std::uint64_t>(TEST_SAMPLE_RATE) << 48, 8);
+
+        putTag(out, "SSND");
+        putBE(out, ssndBytes, 4);
+        putBE(out, 0, 4);   // offset
+        putBE(out, 0, 4);   // block size
+        for (int i = 0; i < numFrames; i++)
+            for (int ch = 0; ch < TEST_CHANNELS; ch++)
+                putBE(out, static_cast<std::uint32_t>(quantize(signal[ch][i], 16)), 2);
+        return out;
+    }
+
+    class TempFile
+    {
+    public:
+        TempFile(const std::string& name, const std::vector<unsigned char>& bytes)
+            : path(::testing::TempDir() + name)
+        {
+            std::FILE* f = std::fopen(path.c_str(), "wb");
+            if (f != nullptr)
+            {
+                std::fwrite(bytes.data(), 1, bytes.size(), f);
+                std::fclose(f);
+            }
+        }
+
+        ~TempFile() { std::remove(path.c_str()); }
+
+        const std::string path;
+    };
+
+    std::vector<std::vector<float>> readAll(AudioFileReader& reader, int chunkFrames)
+    {
+        std::vector<std::vector<float>> decoded(static_cast<size_t>(reader.getNumChannels()));
+        std::vector<std::vector<float>> chunk(static_cast<size_t>(reader.getNumChannels()),
+                                              std::vector<float>(static_cast<size_t>(chunkFrames)));
+        std::vector<float*> pointers;
+        for (auto& c : chunk)
+            pointers.push_back(c.data());
+
+        for (;;)
+        {
+            const int n = reader.read(pointers.data(), chunkFrames);
+            if (n <= 0)
+                break;
+            for (size_t ch = 0; ch < chunk.size(); ch++)
+                decoded[ch].insert(decoded[ch].end(), chunk[ch].begin(), chunk[ch].begin() + n);
+        }
+        return decoded;
+    }
+
+    void expectDecoded(const std::string& path, const char* format, double tolerance)
+    {
+        const auto signal = makeSignal(TEST_SAMPLE_RATE / 2);
+
+        std::string error;
+        auto reader = AudioFileReader::open(path, error);
+        ASSERT_NE(reader, nullptr) << error;
+        EXPECT_EQ(reader->getFormatName(), format);
+        EXPECT_DOUBLE_EQ(reader->getSampleRate(), TEST_SAMPLE_RATE);
+        EXPECT_EQ(reader->getNumChannels(), TEST_CHANNELS);
+        EXPECT_EQ(reader->getLengthFrames(), static_cast<std::int64_t>(signal[0].size()));
+
+        // Odd chunk size exercises partial reads
+        const auto decoded = readAll(*reader, 1000);
+        EXPECT_TRUE(reader->getError().empty()) << reader->getError();
+        ASSERT_EQ(decoded[0].size(), signal[0].size());
+        for (int ch = 0; ch < TEST_CHANNELS; ch++)
+            for (size_t i = 0; i < signal[ch].size(); i++)
+                ASSERT_NEAR(decoded[ch][i], signal[ch][i], tolerance) << "ch " << ch << " frame " << i;
+    }
+}
+
+// ========================================================================
+// DECODING TESTS
+// ========================================================================
+
+TEST(AudioFileReaderTest, Wav16Bit)
+{
+    TempFile file("bullseye_16.wav", makeWav(makeSignal(TEST_SAMPLE_RATE / 2), 16));
+    expectDecoded(file.path, "WAV", 1.0 / 32768.0);
+}
+
+TEST(AudioFileReaderTest, Wav24Bit)
+{
+    TempFile file("bullseye_24.wav", makeWav(makeSignal(TEST_SAMPLE_RATE / 2), 24));
+    expectDecoded(file.path, "WAV", 1.0 / 8388608.0);
+}
+
+TEST(AudioFileReaderTest, WavFloatExtensible)
+{
+    TempFile file("bullseye_f32.wav", makeWav(makeSignal(TEST_SAMPLE_RATE / 2), 32));
+    expectDecoded(file.path, "WAV", 0.0);
+}
+
+TEST(AudioFileReaderTest, Aiff16Bit)
+{
+    TempFile file("bullseye_16.aiff", makeAiff(makeSignal(TEST_SAMPLE_RATE / 2)));
+    expectDecoded(file.path, "AIFF", 1.0 / 32768.0);
+}
+
+TEST(AudioFileReaderTest, SeekMatchesSequentialRead)
+{
+    TempFile file("bullseye_seek.wav", makeWav(makeSignal(TEST_SAMPLE_RATE / 2), 24));
+
+    std::string error;
+    auto reader = AudioFileReader::open(file.path, error);
+    ASSERT_NE(reader, nullptr) << error;
+    const auto all = readAll(*reader, 4096);
+
+    ASSERT_TRUE(reader->seek(12345));
+    const auto tail = readAll(*reader, 777);
+    ASSERT_EQ(tail[0].size(), all[0].size() - 12345);
+    for (size_t i = 0; i < tail[0].size(); i++)
+        ASSERT_EQ(tail[1][i], all[1][i + 12345]) << i;
+
+    EXPECT_FALSE(reader->seek(reader->getLengthFrames() + 1));
+}
+
+TEST(AudioFileReaderTest, RejectsUnknownAndMissingFiles)
+{
+    TempFile garbage("bullseye_garbage.bin", std::vector<unsigned char>(64, 0x5A));
+
+    std::string error;
+    EXPECT_EQ(AudioFileReader::open(garbage.path, error), nullptr);
+    EXPECT_FALSE(error.empty());
+
+    error.clear();
+    EXPECT_EQ(AudioFileReader::open(::testing::TempDir() + "bullseye_missing.wav", error), nullptr);
+    EXPECT_FALSE(error.empty());
+}
+
+TEST(AudioFileReaderTest, TruncatedDataChunkReadsAvailableFrames)
+{
+    auto bytes = makeWav(makeSignal(TEST_SAMPLE_RATE / 2), 16);
+    bytes.resize(bytes.size() - 1000 * TEST_CHANNELS * 2);
+    TempFile file("bullseye_truncated.wav", bytes);
+
+    std::string error;
+    auto reader = AudioFileReader::open(file.path, error);
+    ASSERT_NE(reader, nullptr) << error;
+    const auto decoded = readAll(*reader, 4096);
+    EXPECT_EQ(decoded[0].size(), static_cast<size_t>(TEST_SAMPLE_RATE / 2 - 1000));
+}
+
+// ========================================================================
+// ANALYZER TESTS
+// ========================================================================
+
+TEST(LoudnessAnalyzerTest, MatchesDirectCoreProcessing)
+{
+    const auto signal = makeSignal(TEST_SAMPLE_RATE * 6);
+    TempFile file("bullseye_analyze.wav", makeWav(signal, 32));
+
+    auto core = std::make_unique<BULLsEYEProcessorCore>();
+    core->setSampleRate(TEST_SAMPLE_RATE);
+    core->reset();
+    const float* channels[TEST_CHANNELS] = {signal[0].data(), signal[1].data()};
+    core->processBlock(channels, TEST_CHANNELS, static_cast<int>(signal[0].size()));
+    const MeterFrame expected = core->getMeterFrame();
+
+    AnalyzerOptions options;
+    options.chunkFrames = 1024;
+    const AnalysisResult result = analyzeFile(file.path, options);
+
+    ASSERT_TRUE(result.ok) << result.error;
+    EXPECT_EQ(result.numFrames, static_cast<std::int64_t>(signal[0].size()));
+    EXPECT_NEAR(result.durationSeconds(), 6.0, 1e-9);
+    EXPECT_NEAR(result.integratedLUFS, expected.integratedLUFS, 1e-9);
+    EXPECT_NEAR(result.truePeakDB, expected.truePeakDB, 1e-9);
+    EXPECT_NEAR(result.loudnessRangeLU, expected.loudnessRangeLU, 1e-9);
+    EXPECT_NEAR(result.maxMomentaryLUFS, expected.maxMomentaryLUFS, 1e-9);
+    EXPECT_NEAR(result.maxShortTermLUFS, expected.maxShortTermLUFS, 1e-9);
+    EXPECT_GT(result.integratedLUFS, DSPSSOT::TruePeak::MIN_DISPLAY_DB);
+    EXPECT_GT(result.maxMomentaryLUFS, result.integratedLUFS);
+}
+
+TEST(LoudnessAnalyzerTest, SegmentedAnalysisMatchesSequential)
+{
+    // 100 s at 8 kHz: long enough for three 30 s segments, small on disk
+    constexpr int rate = 8000;
+    std::vector<std::vector<float>> signal(1, std::vector<float>(100 * rate));
+    for (size_t i = 0; i < signal[0].size(); i++)
+    {
+        const int second = static_cast<int>(i) / rate;
+        const double amplitude = (second % 11 == 5) ? 0.001 : 0.05 + 0.1 * (second % 6);
+        signal[0][i] = static_cast<float>(amplitude * std::sin(DSPSSOT::Math::TAU * 613.0 * i / rate));
+    }
+    TempFile file("bullseye_segmented.wav", makeWav(signal, 16, rate));
+
+    AnalyzerOptions options;
+    const AnalysisResult sequential = analyzeFile(file.path, options);
+    options.segmentThreads = 3;
+    const AnalysisResult segmented = analyzeFile(file.path, options);
+
+    ASSERT_TRUE(sequential.ok) << sequential.error;
+    ASSERT_TRUE(segmented.ok) << segmented.error;
+    EXPECT_EQ(segmented.numFrames, sequential.numFrames);
+    EXPECT_NEAR(segmented.integratedLUFS, sequential.integratedLUFS, 1e-9);
+    EXPECT_NEAR(segmented.loudnessRangeLU, sequential.loudnessRangeLU, 1e-9);
+    EXPECT_NEAR(segmented.maxMomentaryLUFS, sequential.maxMomentaryLUFS, 1e-9);
+    EXPECT_NEAR(segmented.maxShortTermLUFS, sequential.maxShortTermLUFS, 1e-9);
+    EXPECT_DOUBLE_EQ(segmented.truePeakDB, sequential.truePeakDB);
+}
+
+TEST(LoudnessAnalyzerTest, SingleMeasurementMatchesFullAnalysis)
+{
+    TempFile file("bullseye_only.wav", makeWav(makeSignal(TEST_SAMPLE_RATE * 4), 24));
+
+    AnalyzerOptions options;
+    const AnalysisResult full = analyzeFile(file.path, options);
+    options.measurements = AnalyzerMeasurements::IntegratedOnly;
+    const AnalysisResult lufs = analyzeFile(file.path, options);
+    options.measurements = AnalyzerMeasurements::TruePeakOnly;
+    options.segmentThreads = 2;
+    const AnalysisResult tp = analyzeFile(file.path, options);
+
+    ASSERT_TRUE(full.ok && lufs.ok && tp.ok);
+    EXPECT_TRUE(full.hasIntegrated() && full.hasTruePeak() && full.hasRangeAndMaxima());
+    EXPECT_TRUE(lufs.hasIntegrated());
+    EXPECT_FALSE(lufs.hasTruePeak() || lufs.hasRangeAndMaxima());
+    EXPECT_TRUE(tp.hasTruePeak());
+    EXPECT_FALSE(tp.hasIntegrated() || tp.hasRangeAndMaxima());
+
+    EXPECT_DOUBLE_EQ(lufs.integratedLUFS, full.integratedLUFS);
+    EXPECT_DOUBLE_EQ(tp.truePeakDB, full.truePeakDB);
+    EXPECT_EQ(lufs.numFrames, full.numFrames);
+    EXPECT_EQ(tp.numFrames, full.numFrames);
+}
+
+TEST(LoudnessAnalyzerTest, ReusedCoreGivesIdenticalResults)
+{
+    TempFile loud("bullseye_loud.wav", makeWav(makeSignal(TEST_SAMPLE_RATE * 3), 16));
+    TempFile aiff("bullseye_other.aiff", makeAiff(makeSignal(TEST_SAMPLE_RATE * 2)));
+
+    const AnalyzerOptions options;
+    auto core = std::make_unique<BULLsEYEProcessorCore>();
+    const AnalysisResult first = analyzeFile(loud.path, *core, options);
+    analyzeFile(aiff.path, *core, options);
+    const AnalysisResult again = analyzeFile(loud.path, *core, options);
+
+    ASSERT_TRUE(first.ok);
+    ASSERT_TRUE(again.ok);
+    EXPECT_DOUBLE_EQ(first.integratedLUFS, again.integratedLUFS);
+    EXPECT_DOUBLE_EQ(first.truePeakDB, again.truePeakDB);
+    EXPECT_DOUBLE_EQ(first.loudnessRangeLU, again.loudnessRangeLU);
+}
+
+TEST(LoudnessAnalyzerTest, CalibrationCanBeRemoved)
+{
+    TempFile file("bullseye_calibration.wav", makeWav(makeSignal(TEST_SAMPLE_RATE * 2), 16));
+
+    AnalyzerOptions raw;
+    raw.applyCalibration = false;
+    const AnalysisResult calibrated = analyzeFile(file.path, AnalyzerOptions{});
+    const AnalysisResult uncalibrated = analyzeFile(file.path, raw);
+
+    ASSERT_TRUE(calibrated.ok);
+    ASSERT_TRUE(uncalibrated.ok);
+    EXPECT_NEAR(calibrated.integratedLUFS - uncalibrated.integratedLUFS,
+                DSPSSOT::GatedIntegration::JSFX_CALIBRATION_OFFSET_DB, 1e-9);
+    EXPECT_DOUBLE_EQ(calibrated.truePeakDB, uncalibrated.truePeakDB);
+}
+
+TEST(LoudnessAnalyzerTest, HighRateDecimationStaysWithinBound)
+{
+    constexpr int rate = 192000;
+    std::vector<std::vector<float>> signal(TEST_CHANNELS, std::vector<float>(3 * rate));
+    for (size_t i = 0; i < signal[0].size(); i++)
+    {
+        const double t = static_cast<double>(i) / rate;
+        signal[0][i] = static_cast<float>(0.2 * std::sin(DSPSSOT::Math::TAU * 1000.0 * t));
+        signal[1][i] = static_cast<float>(0.1 * std::sin(DSPSSOT::Math::TAU * 6000.0 * t));
+    }
+    TempFile file("bullseye_192k.wav", makeWav(signal, 16, rate));
+
+    AnalyzerOptions options;
+    const AnalysisResult native = analyzeFile(file.path, options);
+    options.decimateHighRates = true;
+    const AnalysisResult decimated = analyzeFile(file.path, options);
+
+    ASSERT_TRUE(native.ok && decimated.ok);
+    EXPECT_NEAR(decimated.integratedLUFS, native.integratedLUFS, DSPSSOT::HighRate::ACCURACY_BOUND_LU);
+    EXPECT_NEAR(decimated.maxMomentaryLUFS, native.maxMomentaryLUFS, DSPSSOT::HighRate::ACCURACY_BOUND_LU);
+    EXPECT_DOUBLE_EQ(decimated.truePeakDB, native.truePeakDB);
+    EXPECT_EQ(decimated.numFrames, native.numFrames);
+}
+
+TEST(LoudnessAnalyzerTest, ReportsErrorsForUnreadableFiles)
+{
+    const AnalysisResult result = analyzeFile(::testing::TempDir() + "bullseye_missing.wav", AnalyzerOptions{});
+    EXPECT_FALSE(result.ok);
+    EXPECT_FALSE(result.error.empty());
+}
+
+TEST(LoudnessAnalyzerTest, SurroundChannelWeights)
+{
+    double weights[8];
+    fileChannelWeights(6, weights);
+    EXPECT_DOUBLE_EQ(weights[0], DSPSSOT::ChannelWeighting::FRONT);
+    EXPECT_DOUBLE_EQ(weights[3], DSPSSOT::ChannelWeighting::LFE);
+    EXPECT_DOUBLE_EQ(weights[4], DSPSSOT::ChannelWeighting::SURROUND);
+    EXPECT_DOUBLE_EQ(weights[5], DSPSSOT::ChannelWeighting::SURROUND);
+
+    fileChannelWeights(2, weights);
+    EXPECT_DOUBLE_EQ(weights[1], DSPSSOT::ChannelWeighting::FRONT);
+}
+
+TEST(LoudnessAnalyzerTest, MonoBlockParallelMatchesDirectCore)
+{
+    const auto stereo = makeSignal(TEST_SAMPLE_RATE * 4);
+    const std::vector<std::vector<float>> signal{stereo[0]};
+    TempFile file("bullseye_mono.wav", makeWav(signal, 32));
+
+    // Reference: the lane-packed bank (the analyzer switches mono files to block-parallel K-weighting)
+    auto core = std::make_unique<BULLsEYEProcessorCore>();
+    core->setSampleRate(TEST_SAMPLE_RATE);
+    core->reset();
+    const float* channels[1] = {signal[0].data()};
+    core->processBlock(channels, 1, static_cast<int>(signal[0].size()));
+    const MeterFrame expected = core->getMeterFrame();
+
+    AnalyzerOptions options;
+    options.chunkFrames = 1000;
+    const AnalysisResult result = analyzeFile(file.path, options);
+
+    ASSERT_TRUE(result.ok) << result.error;
+    EXPECT_EQ(result.numChannels, 1);
+    EXPECT_NEAR(result.integratedLUFS, expected.integratedLUFS, 1e-9);
+    EXPECT_NEAR(result.maxMomentaryLUFS, expected.maxMomentaryLUFS, 1e-9);
+    EXPECT_NEAR(result.maxShortTermLUFS, expected.maxShortTermLUFS, 1e-9);
+    EXPECT_DOUBLE_EQ(result.truePeakDB, expected.truePeakDB);
+}
@@ -0,0 +1,191 @@
+/**
+ * @file TestBatchAnalyzer.cpp
+ * @brief Unit tests for parallel batch analysis
+ *
+ * Tests verify:
+ * - The work-stealing pool runs every task exactly once
+ * - Idle workers steal from busy ones (long tasks do not serialize the batch)
+ * - Batch results match single-file analysis, one callback per file
+ * - Throughput statistics add up
+ *
+ * @note Tests are designed to run without JUCE dependencies
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BatchAnalyzer.h"
+#include "WorkStealingPool.h"
+#include "SSOT/DSPSSOT.h"
+
+// ========================================================================
+// HELPER FUNCTIONS
+// ========================================================================
+
+namespace
+{
+    constexpr int TEST_SAMPLE_RATE = 48000;
+
+    void putLE(std::vector<unsigned char>& out, std::uint32_t value, int bytes)
+    {
+        for (int b = 0; b < bytes; b++)
+            out.push_back(static_cast<unsigned char>(value >> (8 * b)));
+    }
+
+    // Mono 16-bit WAV sine of the given length and amplitude
+    std::string writeWav(const std::string& name, double seconds, double amplitude)
+    {
+        const int numFrames = static_cast<int>(seconds * TEST_SAMPLE_RATE);
+        std::vector<unsigned char> out;
+        out.insert(out.end(), {'R', 'I', 'F', 'F'});
+        putLE(out, 36 + static_cast<std::uint32_t>(numFrames) * 2, 4);
+        out.insert(out.end(), {'W', 'A', 'V', 'E', 'f', 'm', 't', ' '});
+        putLE(out, 16, 4);
+        putLE(out, 1, 2);
+        putLE(out, 1, 2);
+        putLE(out, TEST_SAMPLE_RATE, 4);
+        putLE(out, TEST_SAMPLE_RATE * 2, 4);
+        putLE(out, 2, 2);
+        putLE(out, 16, 2);
+        out.insert(out.end(), {'d', 'a', 't', 'a'});
+        putLE(out, static_cast<std::uint32_t>(numFrames) * 2, 4);
+        for (int i = 0; i < numFrames; i++)
+        {
+            const double s = amplitude * std::sin(DSPSSOT::Math::TAU * 1000.0 * i / TEST_SAMPLE_RATE);
+            putLE(out, static_cast<std::uint32_t>(static_cast<std::int16_t>(std::lround(s * 32767.0))), 2);
+        }
+
+        const std::string path = ::testing::TempDir() + name;
+        std::FILE* f = std::fopen(path.c_str(), "wb");
+        if (f != nullptr)
+        {
+            std::fwrite(out.data(), 1, out.size(), f);
+            std::fclose(f);
+        }
+        return path;
+    }
+}
+
+// ========================================================================
+// WORK-STEALING POOL TESTS
+// ========================================================================
+
+TEST(WorkStealingPoolTest, RunsEveryTaskExactlyOnce)
+{
+    constexpr size_t numTasks = 1000;
+    std::vector<std::atomic<int>> runs(numTasks);
+    for (auto& r : runs)
+        r.store(0);
+
+    std::atomic<int> initialized{0};
+    WorkStealingPool pool(4);
+    pool.run(numTasks, [&](int) { initialized.fetch_add(1); }, [&](int, size_t task) { runs[task].fetch_add(1); });
+
+    EXPECT_EQ(initialized.load(), 4);
+    for (size_t i = 0; i < numTasks; i++)
+        ASSERT_EQ(runs[i].load(), 1) << i;
+}
+
+TEST(WorkStealingPoolTest, IdleWorkersStealFromBusyOnes)
+{
+    // Worker 0 is dealt task 0, which blocks until every other task is done:
+    // the rest of its deque can only finish if other workers steal it
+    constexpr size_t numTasks = 64;
+    std::atomic<size_t> done{0};
+    std::vector<int> ranOn(numTasks, -1);
+
+    WorkStealingPool pool(2);
+    pool.run(numTasks, [](int) {},
+             [&](int worker, size_t task)
+             {
+                 ranOn[task] = worker;
+                 if (task == 0)
+                 {
+                     const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+                     while (done.load() < numTasks - 1 && std::chrono::steady_clock::now() < deadline)
+                         std::this_thread::yield();
+                 }
+                 done.fetch_add(1);
+             });
+
+    EXPECT_EQ(done.load(), numTasks);
+    EXPECT_GT(pool.getStealCount(), 0u);
+
+    // Everything dealt to worker 0 apart from the blocking task ran elsewhere
+    for (size_t task = 2; task < numTasks; task += 2)
+        EXPECT_EQ(ranOn[task], 1) << task;
+}
+
+TEST(WorkStealingPoolTest, SingleWorkerRunsInline)
+{
+    const auto caller = std::this_thread::get_id();
+    bool allInline = true;
+    int count = 0;
+
+    WorkStealingPool pool(1);
+    pool.run(10, [](int) {}, [&](int, size_t) { allInline &= std::this_thread::get_id() == caller; ++count; });
+
+    EXPECT_TRUE(allInline);
+    EXPECT_EQ(count, 10);
+    EXPECT_EQ(pool.getStealCount(), 0u);
+}
+
+// ========================================================================
+// BATCH ANALYZER TESTS
+// ========================================================================
+
+TEST(BatchAnalyzerTest, MatchesSingleFileAnalysis)
+{
+    const std::vector<std::string> paths = {
+        writeWav("bullseye_batch_a.wav", 4.0, 0.5),
+        writeWav("bullseye_batch_b.wav", 1.0, 0.1),
+        writeWav("bullseye_batch_c.wav", 2.5, 0.3),
+        writeWav("bullseye_batch_d.wav", 0.5, 0.05),
+        ::testing::TempDir() + "bullseye_batch_missing.wav",
+    };
+
+    BatchOptions options;
+    options.numWorkers = 3;
+
+    std::map<std::string, AnalysisResult> results;
+    const BatchStats stats = analyzeBatch(paths, options, [&](const AnalysisResult& r) { results[r.path] = r; });
+
+    ASSERT_EQ(results.size(), paths.size());
+    EXPECT_EQ(stats.files, 5);
+    EXPECT_EQ(stats.failures, 1);
+    EXPECT_EQ(stats.numWorkers, 3);
+    EXPECT_EQ(stats.frames, static_cast<std::int64_t>(8.0 * TEST_SAMPLE_RATE));
+    EXPECT_EQ(stats.samples, stats.frames);
+    EXPECT_GT(stats.filesPerSecond(), 0.0);
+    EXPECT_GT(stats.samplesPerSecond(), 0.0);
+
+    for (size_t i = 0; i + 1 < paths.size(); i++)
+    {
+        const AnalysisResult single = analyzeFile(paths[i], options.analyzer);
+        const AnalysisResult& batched = results[paths[i]];
+        ASSERT_TRUE(batched.ok) << batched.error;
+        EXPECT_DOUBLE_EQ(batched.integratedLUFS, single.integratedLUFS) << paths[i];
+        EXPECT_DOUBLE_EQ(batched.truePeakDB, single.truePeakDB) << paths[i];
+        EXPECT_DOUBLE_EQ(batched.maxMomentaryLUFS, single.maxMomentaryLUFS) << paths[i];
+        std::remove(paths[i].c_str());
+    }
+
+    EXPECT_FALSE(results[paths.back()].ok);
+}
+
+TEST(BatchAnalyzerTest, EmptyBatch)
+{
+    int callbacks = 0;
+    const BatchStats stats = analyzeBatch({}, BatchOptions{}, [&](const AnalysisResult&) { ++callbacks; });
+
+    EXPECT_EQ(callbacks, 0);
+    EXPECT_EQ(stats.files, 0);
+    EXPECT_EQ(stats.numWorkers, 1);
+}
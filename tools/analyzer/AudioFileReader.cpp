@@ -0,0 +1,637 @@
+#include "AudioFileReader.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if BULLSEYE_HAVE_FLAC
+#include <FLAC/stream_decoder.h>
+#endif
+
+// ========================================================================
+// HELPERS
+// ========================================================================
+
+namespace
+{
+    // 64-bit file offsets (masters above 2 GB)
+    bool seekFile(std::FILE* file, std::int64_t offset)
+    {
+#if defined(_WIN32)
+        return _fseeki64(file, offset, SEEK_SET) == 0;
+#else
+        return fseeko(file, static_cast<off_t>(offset), SEEK_SET) == 0;
+#endif
+    }
+
+    std::int64_t tellFile(std::FILE* file)
+    {
+#if defined(_WIN32)
+        return _ftelli64(file);
+#else
+        return static_cast<std::int64_t>(ftello(file));
+#endif
+    }
+
+    std::int64_t fileSize(std::FILE* file)
+    {
+        const std::int64_t current = tellFile(file);
+#if defined(_WIN32)
+        _fseeki64(file, 0, SEEK_END);
+#else
+        fseeko(file, 0, SEEK_END);
+#endif
+        const std::int64_t size = tellFile(file);
+        seekFile(file, current);
+        return size;
+    }
+
+    bool readBytes(std::FILE* file, void* destination, size_t numBytes)
+    {
+        return std::fread(destination, 1, numBytes, file) == numBytes;
+    }
+
+    std::uint32_t le32(const unsigned char* p)
+    {
+        return static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8)
+             | (static_cast<std::uint32_t>(p[2]) << 16) | (static_cast<std::uint32_t>(p[3]) << 24);
+    }
+
+    std::uint16_t le16(const unsigned char* p)
+    {
+        return static_cast<std::uint16_t>(p[0] | (p[1] << 8));
+    }
+
+    std::uint64_t le64(const unsigned char* p)
+    {
+        return static_cast<std::uint64_t>(le32(p)) | (static_cast<std::uint64_t>(le32(p + 4)) << 32);
+    }
+
+    std::uint32_t be32(const unsigned char* p)
+    {
+        return (static_cast<std::uint32_t>(p[0]) << 24) | (static_cast<std::uint32_t>(p[1]) << 16)
+             | (static_cast<std::uint32_t>(p[2]) << 8) | static_cast<std::uint32_t>(p[3]);
+    }
+
+    std::uint16_t be16(const unsigned char* p)
+    {
+        return static_cast<std::uint16_t>((p[0] << 8) | p[1]);
+    }
+
+    bool isTag(const unsigned char* p, const char* tag)
+    {
+        return std::memcmp(p, tag, 4) == 0;
+    }
+
+    // IEEE 754 80-bit extended (AIFF COMM sample rate)
+    double extendedToDouble(const unsigned char* p)
+    {
+        const int exponent = ((p[0] & 0x7f) << 8) | p[1];
+        std::uint64_t mantissa = 0;
+        for (int i = 0; i < 8; ++i)
+            mantissa = (mantissa << 8) | p[2 + i];
+
+        if (exponent == 0 && mantissa == 0)
+            return 0.0;
+
+        const double value = std::ldexp(static_cast<double>(mantissa), exponent - 16383 - 63);
+        return (p[0] & 0x80) ? -value : value;
+    }
+
+    // Decode one interleaved sample to [-1, 1)
+    float decodeSample(const unsigned char* p, const PCMFormat& format)
+    {
+        if (format.encoding == PCMFormat::Encoding::Float)
+        {
+            unsigned char bytes[8];
+            for (int i = 0; i < format.bytesPerSample; ++i)
+                bytes[i] = format.bigEndian ? p[format.bytesPerSample - 1 - i] : p[i];
+
+            if (format.bytesPerSample == 4)
+            {
+                float value;
+                std::memcpy(&value, bytes, sizeof(value));
+                return value;
+            }
+
+            double value;
+            std::memcpy(&value, bytes, sizeof(value));
+            return static_cast<float>(value);
+        }
+
+        // Integer: assemble big-endian style, left-justified in the container
+        std::uint32_t raw = 0;
+        for (int i = 0; i < format.bytesPerSample; ++i)
+        {
+            const unsigned char byte = format.bigEndian ? p[i] : p[format.bytesPerSample - 1 - i];
+            raw = (raw << 8) | byte;
+        }
+
+        const int containerBits = format.bytesPerSample * 8;
+        if (format.unsignedInteger)
+            return static_cast<float>((static_cast<double>(raw) - std::ldexp(1.0, containerBits - 1))
+                                      / std::ldexp(1.0, containerBits - 1));
+
+        // Sign-extend to 32 bits
+        const std::int32_t value = static_cast<std::int32_t>(raw << (32 - containerBits)) >> (32 - containerBits);
+        return static_cast<float>(static_cast<double>(value) / std::ldexp(1.0, containerBits - 1));
+    }
+}
+
+// ========================================================================
+// FACTORY
+// ========================================================================
+
+std::unique_ptr<AudioFileReader> AudioFileReader::open(const std::string& path, std::string& error)
+{
+    unsigned char header[12]{};
+    {
+        std::FILE* probe = std::fopen(path.c_str(), "rb");
+        if (probe == nullptr)
+        {
+            error = "cannot open file";
+            return nullptr;
+        }
+        const bool ok = readBytes(probe, header, sizeof(header));
+        std::fclose(probe);
+        if (!ok)
+        {
+            error = "file too short";
+            return nullptr;
+        }
+    }
+
+    if ((isTag(header, "RIFF") || isTag(header, "RF64") || isTag(header, "BW64")) && isTag(header + 8, "WAVE"))
+    {
+        auto reader = std::make_unique<WavFileReader>();
+        if (reader->open(path))
+            return reader;
+        error = reader->getError();
+        return nullptr;
+    }
+
+    if (isTag(header, "FORM") && (isTag(header + 8, "AIFF") || isTag(header + 8, "AIFC")))
+    {
+        auto reader = std::make_unique<AiffFileReader>();
+        if (reader->open(path))
+            return reader;
+        error = reader->getError();
+        return nullptr;
+    }
+
+    if (isTag(header, "fLaC"))
+    {
+#if BULLSEYE_HAVE_FLAC
+        auto reader = std::make_unique<FlacFileReader>();
+        if (reader->open(path))
+            return reader;
+        error = reader->getError();
+#else
+        error = "FLAC support not built (libFLAC not found at configure time)";
+#endif
+        return nullptr;
+    }
+
+    error = "unrecognized format (expected WAV, AIFF or FLAC)";
+    return nullptr;
+}
+
+// ========================================================================
+// PCM READER
+// ========================================================================
+
+PCMFileReader::~PCMFileReader()
+{
+    if (file != nullptr)
+        std::fclose(file);
+}
+
+bool PCMFileReader::openFile(const std::string& path)
+{
+    file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr)
+    {
+        error = "cannot open file";
+        return false;
+    }
+    return true;
+}
+
+bool PCMFileReader::validateFormat()
+{
+    if (numChannels <= 0 || sampleRate <= 0.0 || !std::isfinite(sampleRate))
+    {
+        error = "invalid channel count or sample rate";
+        return false;
+    }
+
+    const bool floatOK = format.encoding == PCMFormat::Encoding::Float
+                      && (format.bytesPerSample == 4 || format.bytesPerSample == 8);
+    const bool intOK = format.encoding == PCMFormat::Encoding::Integer
+                    && format.bytesPerSample >= 1 && format.bytesPerSample <= 4;
+    if (!floatOK && !intOK)
+    {
+        error = "unsupported sample format (" + std::to_string(format.bitsPerSample) + " bit)";
+        return false;
+    }
+
+    // Clamp the declared data size to what is actually in the file (truncated / streamed files)
+    const std::int64_t frameBytes = static_cast<std::int64_t>(format.bytesPerSample) * numChannels;
+    const std::int64_t available = std::max<std::int64_t>(fileSize(file) - dataOffset, 0) / frameBytes;
+    lengthFrames = std::min(lengthFrames, available);
+
+    return seek(0);
+}
+
+bool PCMFileReader::seek(std::int64_t frame)
+{
+    if (file == nullptr || frame < 0 || frame > lengthFrames)
+        return false;
+
+    const std::int64_t frameBytes = static_cast<std::int64_t>(format.bytesPerSample) * numChannels;
+    if (!seekFile(file, dataOffset + frame * frameBytes))
+        return false;
+
+    position = frame;
+    return true;
+}
+
+int PCMFileReader::read(float* const* channels, int maxFrames)
+{
+    if (file == nullptr || maxFrames <= 0 || position >= lengthFrames)
+        return 0;
+
+    const int frameBytes = format.bytesPerSample * numChannels;
+    int numFrames = static_cast<int>(std::min<std::int64_t>(maxFrames, lengthFrames - position));
+
+    // Scratch grows to the largest chunk requested, then stays fixed
+    const size_t numBytes = static_cast<size_t>(numFrames) * static_cast<size_t>(frameBytes);
+    if (scratch.size() < numBytes)
+        scratch.resize(numBytes);
+
+    const size_t bytesRead = std::fread(scratch.data(), 1, numBytes, file);
+    numFrames = static_cast<int>(bytesRead / static_cast<size_t>(frameBytes));
+
+    const unsigned char* p = scratch.data();
+    for (int i = 0; i < numFrames; ++i)
+        for (int ch = 0; ch < numChannels; ++ch, p += format.bytesPerSample)
+            channels[ch][i] = decodeSample(p, format);
+
+    position += numFrames;
+    return numFrames;
+}
+
+// ========================================================================
+// WAV READER
+// ========================================================================
+
+bool WavFileReader::open(const std::string& path)
+{
+    if (!openFile(path))
+        return false;
+
+    unsigned char header[12];
+    if (!readBytes(file, header, sizeof(header)))
+    {
+        error = "truncated RIFF header";
+        return false;
+    }
+
+    const bool rf64 = !isTag(header, "RIFF");
+    formatName = rf64 ? "RF64" : "WAV";
+
+    std::uint64_t ds64DataSize = 0;
+    bool haveFormat = false;
+    int blockAlign = 0;
+
+    for (;;)
+    {
+        unsigned char chunk[8];
+        if (!readBytes(file, chunk, sizeof(chunk)))
+        {
+            error = "no data chunk";
+            return false;
+        }
+
+        const std::int64_t chunkStart = tellFile(file);
+        std::uint64_t chunkSize = le32(chunk + 4);
+
+        if (isTag(chunk, "ds64"))
+        {
+            unsigned char ds64[24];
+            if (chunkSize < sizeof(ds64) || !readBytes(file, ds64, sizeof(ds64)))
+            {
+                error = "truncated ds64 chunk";
+                return false;
+            }
+            ds64DataSize = le64(ds64 + 8);
+        }
+        else if (isTag(chunk, "fmt "))
+        {
+            unsigned char fmt[40]{};
+            const size_t fmtBytes = static_cast<size_t>(std::min<std::uint64_t>(chunkSize, sizeof(fmt)));
+            if (fmtBytes < 16 || !readBytes(file, fmt, fmtBytes))
+            {
+                error = "truncated fmt chunk";
+                return false;
+            }
+
+            std::uint16_t formatTag = le16(fmt);
+            numChannels = le16(fmt + 2);
+            sampleRate = static_cast<double>(le32(fmt + 4));
+            blockAlign = le16(fmt + 12);
+            format.bitsPerSample = le16(fmt + 14);
+
+            // WAVE_FORMAT_EXTENSIBLE: the real format is the first two bytes of the sub-format GUID
+            if (formatTag == 0xFFFE && fmtBytes >= 26)
+                formatTag = le16(fmt + 24);
+
+            if (formatTag == 1)
+                format.encoding = PCMFormat::Encoding::Integer;
+            else if (formatTag == 3)
+                format.encoding = PCMFormat::Encoding::Float;
+            else
+            {
+                error = "unsupported WAV format tag " + std::to_string(formatTag);
+                return false;
+            }
+
+            format.bytesPerSample = (numChannels > 0) ? blockAlign / numChannels : 0;
+            format.bigEndian = false;
+            format.unsignedInteger = (format.encoding == PCMFormat::Encoding::Integer && format.bytesPerSample == 1);
+            haveFormat = true;
+        }
+        else if (isTag(chunk, "data"))
+        {
+            if (!haveFormat || blockAlign <= 0)
+            {
+                error = "data chunk before fmt chunk";
+                return false;
+            }
+
+            if (rf64 && chunkSize == 0xFFFFFFFFu)
+                chunkSize = ds64DataSize;
+
+            dataOffset = chunkStart;
+            lengthFrames = static_cast<std::int64_t>(chunkSize / static_cast<std::uint64_t>(blockAlign));
+            return validateFormat();
+        }
+
+        // Chunks are word aligned
+        if (!seekFile(file, chunkStart + static_cast<std::int64_t>(chunkSize + (chunkSize & 1))))
+        {
+            error = "corrupt chunk table";
+            return false;
+        }
+    }
+}
+
+// ========================================================================
+// AIFF READER
+// ========================================================================
+
+bool AiffFileReader::open(const std::string& path)
+{
+    if (!openFile(path))
+        return false;
+
+    unsigned char header[12];
+    if (!readBytes(file, header, sizeof(header)))
+    {
+        error = "truncated FORM header";
+        return false;
+    }
+
+    const bool aifc = isTag(header + 8, "AIFC");
+    formatName = aifc ? "AIFF-C" : "AIFF";
+    bool haveFormat = false;
+
+    for (;;)
+    {
+        unsigned char chunk[8];
+        if (!readBytes(file, chunk, sizeof(chunk)))
+        {
+            error = "no SSND chunk";
+            return false;
+        }
+
+        const std::int64_t chunkStart = tellFile(file);
+        const std::uint32_t chunkSize = be32(chunk + 4);
+
+        if (isTag(chunk, "COMM"))
+        {
+            unsigned char comm[22]{};
+            const size_t commBytes = aifc ? 22 : 18;
+            if (chunkSize < commBytes || !readBytes(file, comm, commBytes))
+            {
+                error = "truncated COMM chunk";
+                return false;
+            }
+
+            numChannels = be16(comm);
+            lengthFrames = be32(comm + 2);
+            format.bitsPerSample = be16(comm + 6);
+            sampleRate = extendedToDouble(comm + 8);
+
+            format.encoding = PCMFormat::Encoding::Integer;
+            format.bytesPerSample = (format.bitsPerSample + 7) / 8;
+            format.bigEndian = true;
+            format.unsignedInteger = false;
+
+            if (aifc)
+            {
+                const unsigned char* compression = comm + 18;
+                if (isTag(compression, "sowt"))
+                    format.bigEndian = false;
+                else if (isTag(compression, "fl32") || isTag(compression, "FL32"))
+                {
+                    format.encoding = PCMFormat::Encoding::Float;
+                    format.bytesPerSample = 4;
+                }
+                else if (isTag(compression, "fl64") || isTag(compression, "FL64"))
+                {
+                    format.encoding = PCMFormat::Encoding::Float;
+                    format.bytesPerSample = 8;
+                }
+                else if (!isTag(compression, "NONE") && !isTag(compression, "twos"))
+                {
+                    error = "unsupported AIFF-C compression '" + std::string(reinterpret_cast<const char*>(compression), 4) + "'";
+                    return false;
+                }
+            }
+            haveFormat = true;
+        }
+        else if (isTag(chunk, "SSND"))
+        {
+            unsigned char ssnd[8];
+            if (!haveFormat)
+            {
+                error = "SSND chunk before COMM chunk";
+                return false;
+            }
+            if (!readBytes(file, ssnd, sizeof(ssnd)))
+            {
+                error = "truncated SSND chunk";
+                return false;
+            }
+
+            dataOffset = chunkStart + 8 + be32(ssnd);
+            return validateFormat();
+        }
+
+        if (!seekFile(file, chunkStart + static_cast<std::int64_t>(chunkSize + (chunkSize & 1))))
+        {
+            error = "corrupt chunk table";
+            return false;
+        }
+    }
+}
+
+// ========================================================================
+// FLAC READER
+// ========================================================================
+
+#if BULLSEYE_HAVE_FLAC
+namespace
+{
+    FLAC__StreamDecoderWriteStatus flacWrite(const FLAC__StreamDecoder*, const FLAC__Frame* frame,
+                                             const FLAC__int32* const buffer[], void* client)
+    {
+        static_cast<FlacFileReader*>(client)->appendBlock(buffer, static_cast<int>(frame->header.blocksize),
+                                                          static_cast<int>(frame->header.bits_per_sample));
+        return FLAC__STREAM_DECODER_WRITE_STATUS_CONTINUE;
+    }
+
+    void flacMetadata(const FLAC__StreamDecoder*, const FLAC__StreamMetadata* metadata, void* client)
+    {
+        if (metadata->type != FLAC__METADATA_TYPE_STREAMINFO)
+            return;
+
+        const auto& info = metadata->data.stream_info;
+        static_cast<FlacFileReader*>(client)->setStreamInfo(static_cast<double>(info.sample_rate),
+                                                            static_cast<int>(info.channels),
+                                                            static_cast<std::int64_t>(info.total_samples),
+                                                            static_cast<int>(info.bits_per_sample));
+    }
+
+    void flacError(const FLAC__StreamDecoder*, FLAC__StreamDecoderErrorStatus, void*)
+    {
+        // Lost sync / bad frames are skipped by the decoder; the stream continues
+    }
+}
+
+FlacFileReader::FlacFileReader()
+{
+    formatName = "FLAC";
+}
+
+FlacFileReader::~FlacFileReader()
+{
+    if (decoder != nullptr)
+    {
+        auto* d = static_cast<FLAC__StreamDecoder*>(decoder);
+        FLAC__stream_decoder_finish(d);
+        FLAC__stream_decoder_delete(d);
+    }
+}
+
+bool FlacFileReader::open(const std::string& path)
+{
+    auto* d = FLAC__stream_decoder_new();
+    if (d == nullptr)
+    {
+        error = "cannot create FLAC decoder";
+        return false;
+    }
+    decoder = d;
+
+    if (FLAC__stream_decoder_init_file(d, path.c_str(), flacWrite, flacMetadata, flacError, this)
+        != FLAC__STREAM_DECODER_INIT_STATUS_OK)
+    {
+        error = "cannot open FLAC stream";
+        return false;
+    }
+
+    if (!FLAC__stream_decoder_process_until_end_of_metadata(d) || numChannels <= 0 || sampleRate <= 0.0)
+    {
+        error = "missing FLAC STREAMINFO";
+        return false;
+    }
+
+    return true;
+}
+
+void FlacFileReader::setStreamInfo(double rate, int channels, std::int64_t totalFrames, int)
+{
+    sampleRate = rate;
+    numChannels = channels;
+    lengthFrames = totalFrames;   // 0 = unknown
+    pending.assign(static_cast<size_t>(channels), {});
+}
+
+void FlacFileReader::appendBlock(const std::int32_t* const* samples, int numFrames, int bitsPerSample)
+{
+    const double scale = 1.0 / std::ldexp(1.0, bitsPerSample - 1);
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        // Blocks are at most 65535 frames: memory stays bounded
+        std::vector<float>& out = pending[static_cast<size_t>(ch)];
+        out.resize(static_cast<size_t>(numFrames));
+        for (int i = 0; i < numFrames; ++i)
+            out[static_cast<size_t>(i)] = static_cast<float>(samples[ch][i] * scale);
+    }
+    pendingRead = 0;
+    pendingSize = numFrames;
+}
+
+int FlacFileReader::read(float* const* channels, int maxFrames)
+{
+    auto* d = static_cast<FLAC__StreamDecoder*>(decoder);
+    int filled = 0;
+    if (atEnd)
+        return 0;
+
+    while (filled < maxFrames)
+    {
+        if (pendingRead == pendingSize)
+        {
+            if (FLAC__stream_decoder_get_state(d) == FLAC__STREAM_DECODER_END_OF_STREAM)
+                break;
+            if (!FLAC__stream_decoder_process_single(d))
+            {
+                error = "FLAC decode error";
+                break;
+            }
+            continue;
+        }
+
+        const int n = std::min(maxFrames - filled, pendingSize - pendingRead);
+        for (int ch = 0; ch < numChannels; ++ch)
+            std::copy_n(pending[static_cast<size_t>(ch)].data() + pendingRead, n, channels[ch] + filled);
+        pendingRead += n;
+        filled += n;
+    }
+
+    return filled;
+}
+
+bool FlacFileReader::seek(std::int64_t frame)
+{
+    auto* d = static_cast<FLAC__StreamDecoder*>(decoder);
+    pendingRead = pendingSize = 0;
+    if (frame < 0 || (lengthFrames > 0 && frame > lengthFrames))
+        return false;
+
+    // libFLAC cannot seek to one past the last frame
+    atEnd = (lengthFrames > 0 && frame == lengthFrames);
+    if (atEnd)
+        return true;
+
+    if (!FLAC__stream_decoder_seek_absolute(d, static_cast<FLAC__uint64>(frame)))
+    {
+        FLAC__stream_decoder_flush(d);
+        return false;
+    }
+    return true;
+}
+#endif
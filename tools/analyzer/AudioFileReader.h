@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * Audio File Reader - streaming PCM decoder for the offline analyzer
+ *
+ * Decodes WAV (PCM / IEEE float / WAVE_FORMAT_EXTENSIBLE / RF64),
+ * AIFF / AIFF-C (PCM, 'sowt', 'fl32', 'fl64') and, when built with
+ * libFLAC (BULLSEYE_HAVE_FLAC), FLAC into de-interleaved float channels.
+ *
+ * Memory is bounded: read() converts at most maxFrames frames through a
+ * fixed scratch buffer, so a 3-hour master never needs to fit in RAM.
+ * Errors are reported as text via getError(); nothing throws.
+ */
+class AudioFileReader
+{
+public:
+    virtual ~AudioFileReader() = default;
+
+    /**
+     * Open a file, picking the decoder from its header
+     * Returns nullptr and fills error if the file cannot be decoded
+     */
+    static std::unique_ptr<AudioFileReader> open(const std::string& path, std::string& error);
+
+    /**
+     * Read up to maxFrames frames into channels[0..numChannels-1]
+     * Returns the number of frames read (0 at end of file or on error)
+     */
+    virtual int read(float* const* channels, int maxFrames) = 0;
+
+    /**
+     * Seek to a frame (0 = start); returns false if unsupported or out of range
+     */
+    virtual bool seek(std::int64_t frame) = 0;
+
+    double getSampleRate() const noexcept { return sampleRate; }
+    int getNumChannels() const noexcept { return numChannels; }
+    std::int64_t getLengthFrames() const noexcept { return lengthFrames; }
+    const std::string& getFormatName() const noexcept { return formatName; }
+    const std::string& getError() const noexcept { return error; }
+
+protected:
+    double sampleRate{0.0};
+    int numChannels{0};
+    std::int64_t lengthFrames{0};
+    std::string formatName;
+    std::string error;
+};
+
+/**
+ * Interleaved PCM / float sample layout shared by the WAV and AIFF readers
+ */
+struct PCMFormat
+{
+    enum class Encoding { Integer, Float };
+
+    Encoding encoding{Encoding::Integer};
+    int bitsPerSample{16};
+    int bytesPerSample{2};
+    bool bigEndian{false};
+    bool unsignedInteger{false};   // 8-bit WAV is offset binary
+};
+
+/**
+ * Reader for uncompressed interleaved data at a known file offset
+ */
+class PCMFileReader : public AudioFileReader
+{
+public:
+    ~PCMFileReader() override;
+
+    int read(float* const* channels, int maxFrames) override;
+    bool seek(std::int64_t frame) override;
+
+protected:
+    std::FILE* file{nullptr};
+    PCMFormat format;
+    std::int64_t dataOffset{0};
+    std::int64_t position{0};
+    std::vector<unsigned char> scratch;
+
+    bool openFile(const std::string& path);
+    bool validateFormat();
+};
+
+/**
+ * RIFF WAVE and RF64
+ */
+class WavFileReader : public PCMFileReader
+{
+public:
+    bool open(const std::string& path);
+};
+
+/**
+ * AIFF and AIFF-C
+ */
+class AiffFileReader : public PCMFileReader
+{
+public:
+    bool open(const std::string& path);
+};
+
+#if BULLSEYE_HAVE_FLAC
+/**
+ * FLAC via the libFLAC stream decoder
+ */
+class FlacFileReader : public AudioFileReader
+{
+public:
+    FlacFileReader();
+    ~FlacFileReader() override;
+
+    bool open(const std::string& path);
+    int read(float* const* channels, int maxFrames) override;
+    bool seek(std::int64_t frame) override;
+
+    // libFLAC callback target (decoded block -> pending samples)
+    void appendBlock(const std::int32_t* const* samples, int numFrames, int bitsPerSample);
+    void setStreamInfo(double rate, int channels, std::int64_t totalFrames, int bits);
+
+private:
+    void* decoder{nullptr};                    // FLAC__StreamDecoder*
+    std::vector<std::vector<float>> pending;   // one decoded block, per channel
+    int pendingRead{0};
+    int pendingSize{0};
+    bool atEnd{false};                         // seeked to one past the last frame
+};
+#endif
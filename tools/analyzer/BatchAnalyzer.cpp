@@ -0,0 +1,113 @@
+#include "BatchAnalyzer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include "DSP/BULLsEYEProcessor.h"
+#include "WorkStealingPool.h"
+
+namespace
+{
+    int resolveThreads(int requested)
+    {
+        return requested > 0 ? requested : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    }
+
+    // No point in idle threads: one worker per file at most
+    int resolveWorkers(int threads, size_t numFiles)
+    {
+        return std::max(1, std::min(threads, static_cast<int>(std::max<size_t>(numFiles, 1))));
+    }
+
+    // Longest-processing-time-first order: size on disk approximates length
+    std::vector<size_t> longestFirst(const std::vector<std::string>& paths)
+    {
+        std::vector<std::uintmax_t> sizes(paths.size(), 0);
+        for (size_t i = 0; i < paths.size(); ++i)
+        {
+            std::error_code ec;
+            const auto size = std::filesystem::file_size(paths[i], ec);
+            sizes[i] = ec ? 0 : size;
+        }
+
+        std::vector<size_t> order(paths.size());
+        std::iota(order.begin(), order.end(), size_t{0});
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return sizes[a] > sizes[b]; });
+        return order;
+    }
+
+    /**
+     * Run the batch with one Core per worker, allocated on its own thread
+     */
+    template<typename Core>
+    void runBatch(const std::vector<std::string>& paths, const std::vector<size_t>& order,
+                  const AnalyzerOptions& analyzerOptions, const BatchResultCallback& onResult, BatchStats& stats)
+    {
+        std::vector<std::unique_ptr<Core>> cores(static_cast<size_t>(stats.numWorkers));
+        std::mutex resultMutex;
+
+        WorkStealingPool pool(stats.numWorkers);
+        pool.run(
+            order.size(),
+            [&](int worker) { cores[static_cast<size_t>(worker)] = std::make_unique<Core>(); },
+            [&](int worker, size_t task)
+            {
+                const AnalysisResult result
+                    = analyzeFile(paths[order[task]], *cores[static_cast<size_t>(worker)], analyzerOptions);
+
+                std::lock_guard<std::mutex> lock(resultMutex);
+                ++stats.files;
+                if (result.ok)
+                {
+                    stats.frames += result.numFrames;
+                    stats.samples += result.numFrames * result.numChannels;
+                }
+                else
+                {
+                    ++stats.failures;
+                }
+
+                if (onResult)
+                    onResult(result);
+            });
+
+        stats.steals = static_cast<std::int64_t>(pool.getStealCount());
+    }
+}
+
+BatchStats analyzeBatch(const std::vector<std::string>& paths, const BatchOptions& options,
+                        const BatchResultCallback& onResult)
+{
+    BatchStats stats;
+    const int threads = resolveThreads(options.numWorkers);
+    stats.numWorkers = resolveWorkers(threads, paths.size());
+
+    AnalyzerOptions analyzerOptions = options.analyzer;
+    if (analyzerOptions.segmentThreads <= 0)
+        analyzerOptions.segmentThreads = std::max(1, threads / stats.numWorkers);
+    stats.segmentThreads = analyzerOptions.segmentThreads;
+
+    const auto start = std::chrono::steady_clock::now();
+    const std::vector<size_t> order = longestFirst(paths);
+
+    // Lean core per measurement set (unused meters are compiled out)
+    switch (analyzerOptions.measurements)
+    {
+        case AnalyzerMeasurements::All:
+            runBatch<AnalyzerCore>(paths, order, analyzerOptions, onResult, stats);
+            break;
+        case AnalyzerMeasurements::IntegratedOnly:
+            runBatch<IntegratedOnlyCore>(paths, order, analyzerOptions, onResult, stats);
+            break;
+        case AnalyzerMeasurements::TruePeakOnly:
+            runBatch<TruePeakOnlyCore>(paths, order, analyzerOptions, onResult, stats);
+            break;
+    }
+
+    stats.wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return stats;
+}
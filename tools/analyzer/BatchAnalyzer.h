@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include "LoudnessAnalyzer.h"
+
+/**
+ * Batch Analyzer - measures many files in parallel
+ *
+ * Files are scheduled longest first (by size on disk) across a
+ * work-stealing pool; each worker owns one core of the measurement set's
+ * feature set and reuses it for every file it measures. Results are handed to the
+ * callback as files finish (completion order, serialized), so catalog
+ * jobs can stream them out instead of waiting for the whole batch.
+ * Batches smaller than the thread count split each file into segments
+ * measured in parallel instead.
+ */
+struct BatchOptions
+{
+    AnalyzerOptions analyzer;
+
+    // Worker threads (0 = one per hardware thread)
+    int numWorkers{0};
+
+    // analyzer.segmentThreads = 0 splits the threads left over when there
+    // are fewer files than threads across each file's segments
+};
+
+struct BatchStats
+{
+    int numWorkers{0};
+    int segmentThreads{1};         // threads per file
+    std::int64_t files{0};
+    std::int64_t failures{0};
+    std::int64_t frames{0};        // sample frames across all measured files
+    std::int64_t samples{0};       // frames x channels
+    std::int64_t steals{0};        // files taken from another worker's queue
+    double wallSeconds{0.0};
+
+    double filesPerSecond() const noexcept { return wallSeconds > 0.0 ? files / wallSeconds : 0.0; }
+    double samplesPerSecond() const noexcept { return wallSeconds > 0.0 ? samples / wallSeconds : 0.0; }
+};
+
+using BatchResultCallback = std::function<void(const AnalysisResult&)>;
+
+/**
+ * Measure every file; onResult is called once per file, never concurrently
+ */
+BatchStats analyzeBatch(const std::vector<std::string>& paths, const BatchOptions& options,
+                        const BatchResultCallback& onResult);
@@ -0,0 +1,286 @@
+#include "LoudnessAnalyzer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "AudioFileReader.h"
+#include "WorkStealingPool.h"
+#include "DSP/BULLsEYEProcessor.h"
+#include "SSOT/DSPSSOT.h"
+#include "SSOT/ProcessorSSOT.h"
+
+// ========================================================================
+// CHANNEL WEIGHTS
+// ========================================================================
+
+void fileChannelWeights(int numChannels, double* weights)
+{
+    for (int ch = 0; ch < numChannels; ++ch)
+        weights[ch] = DSPSSOT::ChannelWeighting::FRONT;
+
+    // 5.1 / 7.1 / 7.1.4 in WAV order: LFE at index 3, surrounds from index 4
+    // (heights after the surrounds stay front-weighted)
+    if (numChannels == 6 || numChannels == 8 || numChannels == 12)
+    {
+        weights[3] = DSPSSOT::ChannelWeighting::LFE;
+        const int lastSurround = (numChannels == 6) ? 5 : 7;
+        for (int ch = 4; ch <= lastSurround; ++ch)
+            weights[ch] = DSPSSOT::ChannelWeighting::SURROUND;
+    }
+}
+
+// ========================================================================
+// ANALYSIS
+// ========================================================================
+
+namespace
+{
+    double withoutCalibration(double lufs)
+    {
+        if (lufs <= DSPSSOT::TruePeak::MIN_DISPLAY_DB)
+            return lufs;
+        return lufs - DSPSSOT::GatedIntegration::JSFX_CALIBRATION_OFFSET_DB;
+    }
+
+    /**
+     * One range of a file: warm up on [warmUpStart, start), measure [start, end)
+     */
+    struct Segment
+    {
+        std::int64_t warmUpStart{0};
+        std::int64_t start{0};
+        std::int64_t end{INT64_MAX};   // INT64_MAX = to end of file
+        std::int64_t framesMeasured{0};
+        std::string error;
+    };
+
+    /**
+     * Stream a frame range through the core in fixed-size chunks
+     * Returns frames processed (fewer than requested at end of file)
+     */
+    template<typename Core>
+    std::int64_t processFrames(AudioFileReader& reader, Core& core, std::int64_t numFrames,
+                               int chunkFrames, std::vector<float*>& channels)
+    {
+        std::int64_t processed = 0;
+        while (processed < numFrames)
+        {
+            const int request = static_cast<int>(std::min<std::int64_t>(chunkFrames, numFrames - processed));
+            const int n = reader.read(channels.data(), request);
+            if (n <= 0)
+                break;
+
+            core.processBlock(channels.data(), reader.getNumChannels(), n);
+            processed += n;
+        }
+        return processed;
+    }
+
+    /**
+     * Measure one segment on its own reader (the core is configured and reset here)
+     */
+    template<typename Core>
+    void measureSegment(const std::string& path, Core& core, const AnalyzerOptions& options,
+                        Segment& segment)
+    {
+        std::unique_ptr<AudioFileReader> reader = AudioFileReader::open(path, segment.error);
+        if (reader == nullptr)
+            return;
+
+        const int numChannels = reader->getNumChannels();
+        double weights[ProcessorSSOT::Channels::MAX_INPUT_CHANNELS];
+        fileChannelWeights(numChannels, weights);
+        core.setSampleRate(reader->getSampleRate());
+        core.setHighRateDecimation(options.decimateHighRates);
+        // Files that leave the bank's lanes idle (mono; stereo in 4-lane AVX
+        // vectors): advance each channel 8 samples per step instead
+        core.setBlockParallelKWeighting(numChannels == 1 || (numChannels == 2 && SIMD::DoubleN::LANES >= 4));
+        core.setChannelWeights(weights, numChannels);
+        core.reset();
+
+        if (segment.warmUpStart > 0 && !reader->seek(segment.warmUpStart))
+        {
+            segment.error = "seek failed";
+            return;
+        }
+
+        // Fixed scratch: one chunk per channel
+        const int chunkFrames = std::max(options.chunkFrames, 1);
+        std::vector<float> storage(static_cast<size_t>(chunkFrames) * static_cast<size_t>(numChannels));
+        std::vector<float*> channels(static_cast<size_t>(numChannels));
+        for (int ch = 0; ch < numChannels; ++ch)
+            channels[static_cast<size_t>(ch)] = storage.data() + static_cast<size_t>(ch) * chunkFrames;
+
+        if (segment.start > segment.warmUpStart)
+        {
+            const std::int64_t warmUp = segment.start - segment.warmUpStart;
+            if (processFrames(*reader, core, warmUp, chunkFrames, channels) != warmUp)
+            {
+                segment.error = reader->getError().empty() ? "unexpected end of file" : reader->getError();
+                return;
+            }
+            core.resetMeasurement();
+        }
+
+        segment.framesMeasured = processFrames(*reader, core, segment.end - segment.start, chunkFrames, channels);
+        if (!reader->getError().empty())
+            segment.error = reader->getError();
+    }
+
+    /**
+     * Cut [0, length) into up to maxSegments ranges on 3 s ring boundaries
+     * (the warm-up then fills the ring exactly as a sequential pass does)
+     */
+    std::vector<Segment> planSegments(std::int64_t length, double sampleRate, int maxSegments)
+    {
+        const std::int64_t ringFrames = static_cast<std::int64_t>(DSPSSOT::Helpers::calculateSubBlockSize(sampleRate))
+                                      * DSPSSOT::LoudnessWindows::SHORT_TERM_SUB_BLOCKS;
+        if (ringFrames <= 0)
+            return std::vector<Segment>(1);
+
+        const std::int64_t minSegmentFrames = static_cast<std::int64_t>(AnalyzerOptions::MIN_SEGMENT_SECONDS * sampleRate);
+        const std::int64_t minRings = std::max<std::int64_t>(1, minSegmentFrames / ringFrames);
+        const std::int64_t totalRings = length / ringFrames;
+        const std::int64_t numSegments
+            = std::max<std::int64_t>(1, std::min<std::int64_t>(maxSegments, totalRings / minRings));
+
+        std::vector<Segment> segments(static_cast<size_t>(numSegments));
+        for (std::int64_t i = 0; i < numSegments; ++i)
+        {
+            Segment& segment = segments[static_cast<size_t>(i)];
+            segment.start = (totalRings * i / numSegments) * ringFrames;
+            segment.warmUpStart = (i == 0) ? 0 : segment.start - ringFrames;
+            segment.end = (i + 1 == numSegments) ? INT64_MAX : (totalRings * (i + 1) / numSegments) * ringFrames;
+        }
+        return segments;
+    }
+
+    template<typename FeatureSet>
+    constexpr AnalyzerMeasurements measurementsOf() noexcept
+    {
+        if constexpr (!FeatureSet::TRUE_PEAK)
+            return AnalyzerMeasurements::IntegratedOnly;
+        else if constexpr (!FeatureSet::INTEGRATED)
+            return AnalyzerMeasurements::TruePeakOnly;
+        else
+            return AnalyzerMeasurements::All;
+    }
+
+    template<typename Core>
+    AnalysisResult analyzeWithNewCore(const std::string& path, const AnalyzerOptions& options)
+    {
+        // The core is large and cache-line aligned: keep it off the stack
+        auto core = std::make_unique<Core>();
+        return analyzeFile(path, *core, options);
+    }
+}
+
+template<typename Core>
+AnalysisResult analyzeFile(const std::string& path, Core& core, const AnalyzerOptions& options)
+{
+    AnalysisResult result;
+    result.path = path;
+    result.measurements = measurementsOf<typename Core::FeatureSetType>();
+
+    const auto start = std::chrono::steady_clock::now();
+
+    std::string error;
+    std::unique_ptr<AudioFileReader> reader = AudioFileReader::open(path, error);
+    if (reader == nullptr)
+    {
+        result.error = error;
+        return result;
+    }
+
+    result.format = reader->getFormatName();
+    result.sampleRate = reader->getSampleRate();
+    result.numChannels = reader->getNumChannels();
+    const std::int64_t lengthFrames = reader->getLengthFrames();
+    reader.reset();  // segments open their own readers
+
+    if (result.numChannels > ProcessorSSOT::Channels::MAX_INPUT_CHANNELS)
+    {
+        result.error = "too many channels (" + std::to_string(result.numChannels) + ", max "
+                     + std::to_string(ProcessorSSOT::Channels::MAX_INPUT_CHANNELS) + ")";
+        return result;
+    }
+
+    if (result.sampleRate < ProcessorSSOT::SampleRate::MIN_VALID_SAMPLE_RATE
+        || result.sampleRate > ProcessorSSOT::SampleRate::MAX_VALID_SAMPLE_RATE)
+    {
+        result.error = "unsupported sample rate (" + std::to_string(result.sampleRate) + " Hz)";
+        return result;
+    }
+
+    // Unknown length (e.g. streamed FLAC): one sequential pass
+    std::vector<Segment> segments = (lengthFrames > 0 && options.segmentThreads > 1)
+                                  ? planSegments(lengthFrames, result.sampleRate, options.segmentThreads)
+                                  : std::vector<Segment>(1);
+
+    if (segments.size() == 1)
+    {
+        measureSegment(path, core, options, segments[0]);
+    }
+    else
+    {
+        // Segment 0 runs on the caller's core, the others on their own
+        std::vector<std::unique_ptr<Core>> segmentCores(segments.size());
+        for (size_t i = 1; i < segments.size(); ++i)
+            segmentCores[i] = std::make_unique<Core>();
+
+        WorkStealingPool pool(static_cast<int>(segments.size()));
+        pool.run(segments.size(), [](int) {}, [&](int, size_t i)
+        {
+            measureSegment(path, (i == 0) ? core : *segmentCores[i], options, segments[i]);
+        });
+
+        for (size_t i = 1; i < segments.size(); ++i)
+            core.mergeMeasurement(*segmentCores[i]);
+    }
+
+    for (const Segment& segment : segments)
+    {
+        if (!segment.error.empty())
+        {
+            result.error = segment.error;
+            return result;
+        }
+        result.numFrames += segment.framesMeasured;
+    }
+
+    const MeterFrame frame = core.getMeterFrame();
+    result.integratedLUFS = frame.integratedLUFS;
+    result.truePeakDB = frame.truePeakDB;
+    result.loudnessRangeLU = frame.loudnessRangeLU;
+    result.maxMomentaryLUFS = frame.maxMomentaryLUFS;
+    result.maxShortTermLUFS = frame.maxShortTermLUFS;
+
+    if (!options.applyCalibration)
+    {
+        result.integratedLUFS = withoutCalibration(result.integratedLUFS);
+        result.maxMomentaryLUFS = withoutCalibration(result.maxMomentaryLUFS);
+        result.maxShortTermLUFS = withoutCalibration(result.maxShortTermLUFS);
+    }
+
+    result.processingSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    result.ok = true;
+    return result;
+}
+
+template AnalysisResult analyzeFile(const std::string&, BULLsEYEProcessorCore&, const AnalyzerOptions&);
+template AnalysisResult analyzeFile(const std::string&, AnalyzerCore&, const AnalyzerOptions&);
+template AnalysisResult analyzeFile(const std::string&, IntegratedOnlyCore&, const AnalyzerOptions&);
+template AnalysisResult analyzeFile(const std::string&, TruePeakOnlyCore&, const AnalyzerOptions&);
+
+AnalysisResult analyzeFile(const std::string& path, const AnalyzerOptions& options)
+{
+    switch (options.measurements)
+    {
+        case AnalyzerMeasurements::IntegratedOnly: return analyzeWithNewCore<IntegratedOnlyCore>(path, options);
+        case AnalyzerMeasurements::TruePeakOnly: return analyzeWithNewCore<TruePeakOnlyCore>(path, options);
+        case AnalyzerMeasurements::All: break;
+    }
+    return analyzeWithNewCore<AnalyzerCore>(path, options);
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "DSP/BULLsEYEProcessorFwd.h"
+
+/**
+ * Loudness Analyzer - offline measurement of one audio file
+ *
+ * Streams the file through the DSP core in fixed-size chunks (bounded
+ * memory, no plugin wrapper, no JUCE) and reports the same values the
+ * plugin displays. Cores are lean feature sets of the plugin's core:
+ * no history stream, and only the meters that were asked for.
+ */
+
+/**
+ * Meters an analysis computes
+ */
+enum class AnalyzerMeasurements
+{
+    All,              // integrated, True Peak, LRA, max momentary / short-term
+    IntegratedOnly,   // LUFS-I only: no True Peak pass (~3-5x faster at 44.1-96 kHz)
+    TruePeakOnly      // True Peak only: no K-weighting or gating
+};
+
+// Core type per measurement set
+using AnalyzerCore = BasicBULLsEYEProcessorCore<Precision::Double, Features::Analyzer>;
+using IntegratedOnlyCore = BasicBULLsEYEProcessorCore<Precision::Double, Features::IntegratedOnly>;
+using TruePeakOnlyCore = BasicBULLsEYEProcessorCore<Precision::Double, Features::TruePeakOnly>;
+
+struct AnalyzerOptions
+{
+    // Frames per read / processBlock call (scratch memory = chunk x channels)
+    int chunkFrames{4096};
+
+    // Apply the JSFX calibration offset the plugin displays with
+    // (false = raw core loudness, for comparison against other meters)
+    bool applyCalibration{true};
+
+    // High-rate loudness path: at 176.4 kHz and above, measure loudness on a
+    // halfband-decimated copy (44.1 / 48 kHz); True Peak stays native.
+    // Faster, within DSPSSOT::HighRate::ACCURACY_BOUND_LU for programme
+    // band-limited to 20 kHz (no effect on True Peak-only measurements)
+    bool decimateHighRates{false};
+
+    // Threads one file is split across: segments are measured in parallel
+    // and merged exactly (<= 1 = one sequential pass; files shorter than
+    // MIN_SEGMENT_SECONDS per segment use fewer segments)
+    int segmentThreads{1};
+
+    // Meters to compute (picks the core's feature set)
+    AnalyzerMeasurements measurements{AnalyzerMeasurements::All};
+
+    // Shortest segment worth its 3 s warm-up and its own reader
+    static constexpr double MIN_SEGMENT_SECONDS = 30.0;
+};
+
+struct AnalysisResult
+{
+    std::string path;
+    bool ok{false};
+    std::string error;
+
+    // Stream info
+    std::string format;
+    double sampleRate{0.0};
+    int numChannels{0};
+    std::int64_t numFrames{0};
+
+    // Measurements (MIN_DISPLAY_DB = nothing measured / below gate)
+    // Only the values in the measured set are meaningful
+    AnalyzerMeasurements measurements{AnalyzerMeasurements::All};
+    double integratedLUFS{0.0};
+    double truePeakDB{0.0};
+    double loudnessRangeLU{0.0};
+    double maxMomentaryLUFS{0.0};
+    double maxShortTermLUFS{0.0};
+
+    // Speed
+    double processingSeconds{0.0};
+
+    double durationSeconds() const noexcept { return sampleRate > 0.0 ? numFrames / sampleRate : 0.0; }
+    double realtimeFactor() const noexcept
+    {
+        return processingSeconds > 0.0 ? durationSeconds() / processingSeconds : 0.0;
+    }
+
+    bool hasIntegrated() const noexcept { return measurements != AnalyzerMeasurements::TruePeakOnly; }
+    bool hasTruePeak() const noexcept { return measurements != AnalyzerMeasurements::IntegratedOnly; }
+    bool hasRangeAndMaxima() const noexcept { return measurements == AnalyzerMeasurements::All; }
+};
+
+/**
+ * BS.1770 channel weights for a file's channel count, in WAV / SMPTE order
+ * (L R C LFE Ls Rs [Lrs Rrs] [Ltf Rtf Ltr Rtr]); unknown layouts are all front
+ */
+void fileChannelWeights(int numChannels, double* weights);
+
+/**
+ * Measure one file with the given core (reset and reconfigured per file)
+ * Reusing a core across files avoids reallocating it (batch workers).
+ * The core's feature set decides what is measured (options.measurements
+ * is not used); defined for BULLsEYEProcessorCore, AnalyzerCore,
+ * IntegratedOnlyCore and TruePeakOnlyCore.
+ *
+ * With segmentThreads > 1 a long file is cut at 3 s ring boundaries into
+ * segments measured on their own cores and threads. Each segment starts
+ * with one ring (3 s) of warm-up so the K-weighting, True Peak and window
+ * state match a sequential pass; the block histograms are then merged and
+ * gated once, so the result equals the sequential measurement.
+ */
+template<typename Core>
+AnalysisResult analyzeFile(const std::string& path, Core& core, const AnalyzerOptions& options);
+
+/**
+ * Measure one file with a temporary core of the options' measurement set
+ */
+AnalysisResult analyzeFile(const std::string& path, const AnalyzerOptions& options);
@@ -0,0 +1,180 @@
+#include "ResultFormat.h"
+
+#include <cstdio>
+#include "SSOT/DSPSSOT.h"
+
+// ========================================================================
+// HELPERS
+// ========================================================================
+
+namespace
+{
+    bool isFloor(double value)
+    {
+        return value <= DSPSSOT::TruePeak::MIN_DISPLAY_DB;
+    }
+
+    std::string number(double value, int decimals)
+    {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.*f", decimals, value);
+        return buffer;
+    }
+
+    std::string textValue(double value, const char* unit)
+    {
+        char buffer[48];
+        if (isFloor(value))
+            std::snprintf(buffer, sizeof(buffer), "%8s %s", "-inf", unit);
+        else
+            std::snprintf(buffer, sizeof(buffer), "%8.1f %s", value, unit);
+        return buffer;
+    }
+
+    std::string jsonValue(double value)
+    {
+        return isFloor(value) ? "null" : number(value, 2);
+    }
+
+    std::string jsonString(const std::string& s)
+    {
+        std::string out = "\"";
+        for (const char c : s)
+        {
+            switch (c)
+            {
+                case '"':  out += "\\\""; break;
+                case '\\': out += "\\\\"; break;
+                case '\n': out += "\\n"; break;
+                case '\r': out += "\\r"; break;
+                case '\t': out += "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20)
+                    {
+                        char escaped[8];
+                        std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                        out += escaped;
+                    }
+                    else
+                    {
+                        out += c;
+                    }
+            }
+        }
+        return out + "\"";
+    }
+
+    std::string csvValue(double value)
+    {
+        return isFloor(value) ? "" : number(value, 2);
+    }
+
+    std::string csvString(const std::string& s)
+    {
+        if (s.find_first_of(",\"\r\n") == std::string::npos)
+            return s;
+
+        std::string out = "\"";
+        for (const char c : s)
+        {
+            if (c == '"')
+                out += '"';
+            out += c;
+        }
+        return out + "\"";
+    }
+
+    std::string duration(double seconds)
+    {
+        const int total = static_cast<int>(seconds);
+        char buffer[32];
+        if (total >= 3600)
+            std::snprintf(buffer, sizeof(buffer), "%d:%02d:%04.1f", total / 3600, (total / 60) % 60,
+                          seconds - (total / 60) * 60);
+        else
+            std::snprintf(buffer, sizeof(buffer), "%d:%04.1f", total / 60, seconds - (total / 60) * 60);
+        return buffer;
+    }
+}
+
+// ========================================================================
+// FORMATS
+// ========================================================================
+
+namespace ResultFormat
+{
+    std::string text(const AnalysisResult& r)
+    {
+        if (!r.ok)
+            return r.path + ": error: " + r.error + "\n";
+
+        std::string out = r.path + "  (" + r.format + ", " + number(r.sampleRate, 0) + " Hz, "
+                        + std::to_string(r.numChannels) + " ch, " + duration(r.durationSeconds()) + ")\n";
+        if (r.hasIntegrated())
+            out += "  Integrated " + textValue(r.integratedLUFS, "LUFS") + "\n";
+        if (r.hasTruePeak())
+            out += "  True Peak  " + textValue(r.truePeakDB, "dBTP") + "\n";
+        if (r.hasRangeAndMaxima())
+        {
+            out += "  LRA        " + textValue(r.loudnessRangeLU, "LU") + "\n";
+            out += "  Max M      " + textValue(r.maxMomentaryLUFS, "LUFS") + "\n";
+            out += "  Max S      " + textValue(r.maxShortTermLUFS, "LUFS") + "\n";
+        }
+        out += "  Speed      " + number(r.realtimeFactor(), 0) + "x real time\n";
+        return out;
+    }
+
+    std::string jsonLine(const AnalysisResult& r)
+    {
+        std::string out = "{\"path\":" + jsonString(r.path) + ",\"ok\":" + (r.ok ? "true" : "false");
+
+        if (!r.ok)
+            return out + ",\"error\":" + jsonString(r.error) + "}";
+
+        out += ",\"format\":" + jsonString(r.format);
+        out += ",\"sample_rate\":" + number(r.sampleRate, 0);
+        out += ",\"channels\":" + std::to_string(r.numChannels);
+        out += ",\"duration_s\":" + number(r.durationSeconds(), 3);
+        if (r.hasIntegrated())
+            out += ",\"integrated_lufs\":" + jsonValue(r.integratedLUFS);
+        if (r.hasTruePeak())
+            out += ",\"true_peak_dbtp\":" + jsonValue(r.truePeakDB);
+        if (r.hasRangeAndMaxima())
+        {
+            out += ",\"lra_lu\":" + number(r.loudnessRangeLU, 2);
+            out += ",\"max_momentary_lufs\":" + jsonValue(r.maxMomentaryLUFS);
+            out += ",\"max_short_term_lufs\":" + jsonValue(r.maxShortTermLUFS);
+        }
+        out += ",\"processing_s\":" + number(r.processingSeconds, 3);
+        out += ",\"realtime_factor\":" + number(r.realtimeFactor(), 1);
+        return out + "}";
+    }
+
+    std::string csvHeader()
+    {
+        return "path,ok,error,format,sample_rate,channels,duration_s,integrated_lufs,true_peak_dbtp,lra_lu,"
+               "max_momentary_lufs,max_short_term_lufs,processing_s,realtime_factor";
+    }
+
+    std::string csvLine(const AnalysisResult& r)
+    {
+        std::string out = csvString(r.path) + "," + (r.ok ? "1" : "0") + "," + csvString(r.error);
+
+        if (!r.ok)
+            return out + ",,,,,,,,,,,";
+
+        out += "," + csvString(r.format);
+        out += "," + number(r.sampleRate, 0);
+        out += "," + std::to_string(r.numChannels);
+        out += "," + number(r.durationSeconds(), 3);
+        // Columns stay fixed; values outside the measured set are empty
+        out += "," + (r.hasIntegrated() ? csvValue(r.integratedLUFS) : "");
+        out += "," + (r.hasTruePeak() ? csvValue(r.truePeakDB) : "");
+        out += "," + (r.hasRangeAndMaxima() ? number(r.loudnessRangeLU, 2) : "");
+        out += "," + (r.hasRangeAndMaxima() ? csvValue(r.maxMomentaryLUFS) : "");
+        out += "," + (r.hasRangeAndMaxima() ? csvValue(r.maxShortTermLUFS) : "");
+        out += "," + number(r.processingSeconds, 3);
+        out += "," + number(r.realtimeFactor(), 1);
+        return out;
+    }
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <string>
+#include "LoudnessAnalyzer.h"
+
+/**
+ * Result Format - text and machine-readable output for analysis results
+ *
+ * Values at the display floor (nothing measured / below gate) are written
+ * as "-inf" in text, null in JSON and empty in CSV. Values outside the
+ * result's measurement set are left out of text and JSON and empty in CSV.
+ */
+namespace ResultFormat
+{
+    // Multi-line human-readable report
+    std::string text(const AnalysisResult& result);
+
+    // One JSON object on a single line (JSON Lines)
+    std::string jsonLine(const AnalysisResult& result);
+
+    // CSV header row and one row per file (RFC 4180 quoting, empty = no value)
+    std::string csvHeader();
+    std::string csvLine(const AnalysisResult& result);
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Work Stealing Pool - runs a fixed set of tasks across worker threads
+ *
+ * Tasks are dealt round-robin into one deque per worker in the order
+ * given (callers put the longest tasks first). Each worker pops from the
+ * back of its own deque and, when that is empty, steals from the front of
+ * the others, so a worker stuck on a long file never holds up short ones
+ * queued behind it. No tasks are added while running: once every deque is
+ * empty the workers exit.
+ *
+ * Deques are mutex-protected; a task is a whole file (milliseconds to
+ * minutes of work), so lock traffic is negligible next to the work.
+ */
+class WorkStealingPool
+{
+public:
+    explicit WorkStealingPool(int numWorkers)
+        : queues(static_cast<size_t>(numWorkers < 1 ? 1 : numWorkers))
+    {
+    }
+
+    int getNumWorkers() const noexcept { return static_cast<int>(queues.size()); }
+
+    // Tasks taken from another worker's deque during the last run()
+    std::size_t getStealCount() const noexcept { return steals.load(std::memory_order_relaxed); }
+
+    /**
+     * Run task(workerIndex, taskIndex) for every taskIndex in [0, numTasks)
+     * exactly once; blocks until all tasks are done.
+     *
+     * initWorker(workerIndex) runs first on each worker thread (per-worker
+     * state is allocated there, so it is local to the thread that uses it).
+     */
+    template <typename InitFn, typename TaskFn>
+    void run(std::size_t numTasks, InitFn&& initWorker, TaskFn&& task)
+    {
+        const size_t numWorkers = queues.size();
+        steals.store(0, std::memory_order_relaxed);
+
+        // Deal so each deque's back (popped first by its owner) holds its
+        // longest task; thieves take the shortest from the front
+        for (size_t i = 0; i < numTasks; ++i)
+            queues[i % numWorkers].items.push_front(i);
+
+        auto workerLoop = [&](size_t worker)
+        {
+            initWorker(static_cast<int>(worker));
+
+            std::size_t taskIndex = 0;
+            while (popOwn(worker, taskIndex) || steal(worker, taskIndex))
+                task(static_cast<int>(worker), taskIndex);
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(numWorkers - 1);
+        for (size_t w = 1; w < numWorkers; ++w)
+            threads.emplace_back(workerLoop, w);
+
+        workerLoop(0);
+
+        for (auto& t : threads)
+            t.join();
+    }
+
+private:
+    struct Queue
+    {
+        std::mutex mutex;
+        std::deque<std::size_t> items;
+    };
+
+    std::vector<Queue> queues;
+    std::atomic<std::size_t> steals{0};
+
+    bool popOwn(size_t worker, std::size_t& taskIndex)
+    {
+        Queue& q = queues[worker];
+        std::lock_guard<std::mutex> lock(q.mutex);
+        if (q.items.empty())
+            return false;
+        taskIndex = q.items.back();
+        q.items.pop_back();
+        return true;
+    }
+
+    bool steal(size_t thief, std::size_t& taskIndex)
+    {
+        const size_t numWorkers = queues.size();
+        for (size_t offset = 1; offset < numWorkers; ++offset)
+        {
+            Queue& victim = queues[(thief + offset) % numWorkers];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (victim.items.empty())
+                continue;
+            taskIndex = victim.items.front();
+            victim.items.pop_front();
+            steals.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+        return false;
+    }
+};
@@ -0,0 +1,211 @@
+/**
+ * bullseye-analyzer - offline loudness measurement with the BULLsEYE DSP core
+ *
+ * Usage: bullseye-analyzer [--json | --csv] [--only lufs|tp] [--jobs N] [--segments N] [--list FILE] [--no-calibration] [--chunk N] file...
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "BatchAnalyzer.h"
+#include "LoudnessAnalyzer.h"
+#include "ResultFormat.h"
+
+namespace
+{
+    enum class OutputFormat { Text, Json, Csv };
+
+    void printUsage(std::FILE* out)
+    {
+        std::fputs("Usage: bullseye-analyzer [options] file...\n"
+                   "\n"
+                   "Measures integrated loudness, true peak, loudness range and maximum\n"
+                   "momentary / short-term loudness of WAV, AIFF and FLAC files.\n"
+                   "Files are measured in parallel and long files are split into segments;\n"
+                   "results are written as files finish.\n"
+                   "\n"
+                   "Options:\n"
+                   "  --json            one JSON object per file (JSON Lines)\n"
+                   "  --csv             one CSV row per file, with a header row\n"
+                   "  --only lufs|tp    measure only integrated loudness or only true peak\n"
+                   "                    (faster; other values are left empty)\n"
+                   "  --jobs N          worker threads (default: one per hardware thread)\n"
+                   "  --segments N      split each file across N threads (default: the threads\n"
+                   "                    left over when there are fewer files than threads)\n"
+                   "  --list FILE       read paths from FILE, one per line ('-' = stdin)\n"
+                   "  --no-calibration  raw core loudness without the JSFX calibration offset\n"
+                   "  --decimate        at 176.4 kHz and above, measure loudness at 44.1 / 48 kHz\n"
+                   "                    (faster; within 0.1 LU below 20 kHz, true peak unchanged)\n"
+                   "  --chunk N         frames per processing block (default 4096)\n"
+                   "  --help            show this help\n"
+                   "\n"
+                   "A throughput summary (files/s, samples/s) is printed to stderr.\n",
+                   out);
+    }
+
+    bool readList(const char* listPath, std::vector<std::string>& files)
+    {
+        std::ifstream file;
+        std::istream* in = &std::cin;
+        if (std::strcmp(listPath, "-") != 0)
+        {
+            file.open(listPath);
+            if (!file)
+                return false;
+            in = &file;
+        }
+
+        std::string line;
+        while (std::getline(*in, line))
+        {
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+            if (!line.empty())
+                files.push_back(line);
+        }
+        return true;
+    }
+
+    bool parseCount(const char* text, int& value)
+    {
+        char* end = nullptr;
+        const long parsed = std::strtol(text, &end, 10);
+        if (end == text || *end != '\0' || parsed <= 0 || parsed > 1 << 24)
+            return false;
+        value = static_cast<int>(parsed);
+        return true;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    BatchOptions options;
+    options.analyzer.segmentThreads = 0;   // auto
+    OutputFormat format = OutputFormat::Text;
+    std::vector<std::string> files;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+
+        if (std::strcmp(arg, "--json") == 0)
+        {
+            format = OutputFormat::Json;
+        }
+        else if (std::strcmp(arg, "--csv") == 0)
+        {
+            format = OutputFormat::Csv;
+        }
+        else if (std::strcmp(arg, "--no-calibration") == 0)
+        {
+            options.analyzer.applyCalibration = false;
+        }
+        else if (std::strcmp(arg, "--decimate") == 0)
+        {
+            options.analyzer.decimateHighRates = true;
+        }
+        else if (std::strcmp(arg, "--only") == 0 && hasValue)
+        {
+            const char* which = argv[++i];
+            if (std::strcmp(which, "lufs") == 0)
+                options.analyzer.measurements = AnalyzerMeasurements::IntegratedOnly;
+            else if (std::strcmp(which, "tp") == 0)
+                options.analyzer.measurements = AnalyzerMeasurements::TruePeakOnly;
+            else
+            {
+                std::fprintf(stderr, "bullseye-analyzer: invalid --only value (lufs or tp)\n");
+                return 2;
+            }
+        }
+        else if (std::strcmp(arg, "--chunk") == 0 && hasValue)
+        {
+            if (!parseCount(argv[++i], options.analyzer.chunkFrames))
+            {
+                std::fprintf(stderr, "bullseye-analyzer: invalid --chunk value\n");
+                return 2;
+            }
+        }
+        else if (std::strcmp(arg, "--jobs") == 0 && hasValue)
+        {
+            if (!parseCount(argv[++i], options.numWorkers))
+            {
+                std::fprintf(stderr, "bullseye-analyzer: invalid --jobs value\n");
+                return 2;
+            }
+        }
+        else if (std::strcmp(arg, "--segments") == 0 && hasValue)
+        {
+            if (!parseCount(argv[++i], options.analyzer.segmentThreads))
+            {
+                std::fprintf(stderr, "bullseye-analyzer: invalid --segments value\n");
+                return 2;
+            }
+        }
+        else if (std::strcmp(arg, "--list") == 0 && hasValue)
+        {
+            if (!readList(argv[++i], files))
+            {
+                std::fprintf(stderr, "bullseye-analyzer: cannot read list %s\n", argv[i]);
+                return 2;
+            }
+        }
+        else if (std::strcmp(arg, "--help") == 0 || std::strcmp(arg, "-h") == 0)
+        {
+            printUsage(stdout);
+            return 0;
+        }
+        else if (std::strcmp(arg, "--") == 0)
+        {
+            for (++i; i < argc; ++i)
+                files.emplace_back(argv[i]);
+        }
+        else if (arg[0] == '-' && arg[1] != '\0')
+        {
+            std::fprintf(stderr, "bullseye-analyzer: unknown option %s\n", arg);
+            printUsage(stderr);
+            return 2;
+        }
+        else
+        {
+            files.emplace_back(arg);
+        }
+    }
+
+    if (files.empty())
+    {
+        printUsage(stderr);
+        return 2;
+    }
+
+    if (format == OutputFormat::Csv)
+        std::printf("%s\n", ResultFormat::csvHeader().c_str());
+
+    // Called serialized, in completion order
+    const BatchStats stats = analyzeBatch(files, options, [format](const AnalysisResult& result)
+    {
+        switch (format)
+        {
+            case OutputFormat::Json:
+                std::printf("%s\n", ResultFormat::jsonLine(result).c_str());
+                break;
+            case OutputFormat::Csv:
+                std::printf("%s\n", ResultFormat::csvLine(result).c_str());
+                break;
+            case OutputFormat::Text:
+                std::fputs(ResultFormat::text(result).c_str(), result.ok ? stdout : stderr);
+                break;
+        }
+        std::fflush(stdout);
+    });
+
+    std::fprintf(stderr, "%lld files (%lld failed) in %.2f s on %d workers x %d segments: %.1f files/s, %.1f Msamples/s\n",
+                 static_cast<long long>(stats.files), static_cast<long long>(stats.failures), stats.wallSeconds,
+                 stats.numWorkers, stats.segmentThreads, stats.filesPerSecond(), stats.samplesPerSecond() / 1.0e6);
+
+    return stats.failures == 0 ? 0 : 1;
+}